@@ -93,6 +93,7 @@ extensions: make map! [
     ODBC -
     PNG -
     Process -
+    Rebin -
     Secure -
     Serial -
     Signal -
@@ -294,6 +294,15 @@ REBNATIVE(checksum)
         uLong adler = z_adler32(0L, data, len);
         return Init_Integer(D_OUT, adler);
     }
+    else if (rebDidQ("'HASH64 =", ARG(method), rebEND)) {
+        //
+        // The word-at-a-time hash the core uses for its hash tables, as a
+        // full 64-bit value.  It is not a standard hash and its results
+        // should not be persisted; they may change between versions.
+        //
+        uint64_t h = Hash64_Bytes(data, len);
+        return Init_Integer(D_OUT, cast(REBI64, h));
+    }
     else if (rebDidQ("'TCP =", ARG(method), rebEND)) {
         //
         // !!! This was an "Internet TCP 16-bit checksum" that was initially
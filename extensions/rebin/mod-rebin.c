@@ -0,0 +1,1168 @@
+//
+//  File: %mod-rebin.c
+//  Summary: "Compact binary serialization of Rebol values"
+//  Section: Extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2012-2019 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// See %extensions/rebin/README.md for the format.
+//
+// SAVE and LOAD of data go through MOLD and the scanner, which is slow for
+// large structures and loses anything that has no source notation (sharing
+// of series between values, cycles, series positions, bindings).  This
+// codec walks the cells directly and writes each series body only once,
+// with later appearances of the same series written as a back reference.
+// Decoding builds the arrays and contexts in that same order, so references
+// (including cyclic ones) come back as the same series.
+//
+// Words are written as indices into a table of spellings that is built up
+// as the output is written, so each spelling's UTF-8 appears only once.
+//
+// The decoder treats its input as untrusted: lengths are checked against
+// the bytes remaining, UTF-8 is validated, and object keys, word bindings,
+// and paths are checked so that a corrupt input can only raise an error.
+//
+
+#include "sys-core.h"
+
+#include "tmp-mod-rebin.h"
+
+
+// The header is the magic bytes followed by the format version.
+//
+static const REBYTE Rebin_Magic[] = {'R', 'E', 'B', 'I', 'N'};
+
+#define REBIN_VERSION 1
+
+#define REBIN_HEADER_SIZE \
+    (sizeof(Rebin_Magic) + 1)
+
+// Every value starts with a tag byte.  The low bits hold a code from the
+// Rebin_Kinds[] table below (kept separate from enum Reb_Kind, so that the
+// format doesn't change when %types.r is reordered).
+//
+#define REBIN_TAG_NEWLINE 0x40  // CELL_FLAG_NEWLINE_BEFORE
+#define REBIN_TAG_QUOTED 0x80  // varint quoting depth follows the tag
+#define REBIN_CODE_MASK 0x3F
+
+// Codes are never renumbered; new types go on the end.  Code 0 is not used,
+// so that zeroed bytes don't decode as a value.
+//
+static const enum Reb_Kind Rebin_Kinds[] = {
+    REB_0,
+    REB_NULLED,  // only legal as the value of an object field
+    REB_VOID,
+    REB_BLANK,
+    REB_LOGIC,
+    REB_INTEGER,
+    REB_DECIMAL,
+    REB_PERCENT,
+    REB_MONEY,
+    REB_CHAR,
+    REB_TIME,
+    REB_DATE,
+    REB_PAIR,
+    REB_TUPLE,
+    REB_DATATYPE,
+    REB_BITSET,
+    REB_BINARY,
+    REB_TEXT,
+    REB_FILE,
+    REB_EMAIL,
+    REB_URL,
+    REB_TAG,
+    REB_ISSUE,
+    REB_WORD,
+    REB_SET_WORD,
+    REB_GET_WORD,
+    REB_SYM_WORD,
+    REB_BLOCK,
+    REB_SET_BLOCK,
+    REB_GET_BLOCK,
+    REB_SYM_BLOCK,
+    REB_GROUP,
+    REB_SET_GROUP,
+    REB_GET_GROUP,
+    REB_SYM_GROUP,
+    REB_PATH,
+    REB_SET_PATH,
+    REB_GET_PATH,
+    REB_SYM_PATH,
+    REB_MAP,
+    REB_OBJECT
+};
+
+#define REBIN_NUM_CODES \
+    (sizeof(Rebin_Kinds) / sizeof(Rebin_Kinds[0]))
+
+// Reverse of Rebin_Kinds[], filled in on first use.  0 if not encodable.
+//
+static REBYTE Rebin_Codes[REB_MAX];
+
+
+static bool Has_Rebin_Header(const REBYTE *data, REBLEN len)
+{
+    if (len < REBIN_HEADER_SIZE)
+        return false;
+    if (memcmp(data, Rebin_Magic, sizeof(Rebin_Magic)) != 0)
+        return false;
+    return data[sizeof(Rebin_Magic)] == REBIN_VERSION;
+}
+
+
+//=//// ENCODER TABLES ////////////////////////////////////////////////////=//
+//
+// The encoder has to map spellings and series to the index they got when
+// they were first written.  An open-addressed table keyed by pointer is used
+// for this.  Its slots live in an unmanaged series, so that a fail() in the
+// middle of encoding (e.g. on an ACTION!) frees it along with the output.
+//
+
+struct Rebin_Slot {
+    const void *key;  // REBSTR* spelling, or the REBSER* of a series body
+    REBLEN id;  // 1-based order of first appearance in the output
+    enum Reb_Kind body;  // how the body was written, e.g. REB_TEXT
+};
+
+struct Rebin_Table {
+    REBSER *slots;
+    REBLEN capacity;  // always a power of 2
+    REBLEN used;  // slots with a key in them
+    REBLEN count;  // ids handed out so far
+};
+
+static void Init_Rebin_Table(struct Rebin_Table *t)
+{
+    t->capacity = 64;
+    t->used = 0;
+    t->count = 0;
+    t->slots = Make_Series_Core(
+        t->capacity,
+        sizeof(struct Rebin_Slot),
+        SERIES_FLAG_ALWAYS_DYNAMIC
+    );
+    memset(
+        SER_HEAD(struct Rebin_Slot, t->slots),
+        0,
+        t->capacity * sizeof(struct Rebin_Slot)
+    );
+}
+
+static REBLEN Rebin_Slot_Index(const struct Rebin_Table *t, const void *key)
+{
+    REBU64 h = cast(REBU64, cast(uintptr_t, key)) * 0x9E3779B97F4A7C15ull;
+    return cast(REBLEN, h >> 32) & (t->capacity - 1);
+}
+
+// Returns the slot holding `key`, or the free slot where it would go.
+//
+static struct Rebin_Slot *Find_Rebin_Slot(
+    struct Rebin_Table *t,
+    const void *key
+){
+    struct Rebin_Slot *slots = SER_HEAD(struct Rebin_Slot, t->slots);
+    REBLEN mask = t->capacity - 1;
+    REBLEN n = Rebin_Slot_Index(t, key);
+    while (slots[n].key != nullptr and slots[n].key != key)
+        n = (n + 1) & mask;
+    return &slots[n];
+}
+
+static void Add_Rebin_Slot(
+    struct Rebin_Table *t,
+    const void *key,
+    REBLEN id,
+    enum Reb_Kind body
+){
+    if ((t->used + 1) * 2 > t->capacity) {  // keep load at 1/2 or less
+        REBSER *old = t->slots;
+        REBLEN old_capacity = t->capacity;
+
+        t->capacity *= 2;
+        t->slots = Make_Series_Core(
+            t->capacity,
+            sizeof(struct Rebin_Slot),
+            SERIES_FLAG_ALWAYS_DYNAMIC
+        );
+        memset(
+            SER_HEAD(struct Rebin_Slot, t->slots),
+            0,
+            t->capacity * sizeof(struct Rebin_Slot)
+        );
+
+        struct Rebin_Slot *src = SER_HEAD(struct Rebin_Slot, old);
+        REBLEN n;
+        for (n = 0; n < old_capacity; ++n) {
+            if (src[n].key != nullptr)
+                *Find_Rebin_Slot(t, src[n].key) = src[n];
+        }
+        Free_Unmanaged_Series(old);
+    }
+
+    struct Rebin_Slot *slot = Find_Rebin_Slot(t, key);
+    assert(slot->key == nullptr);
+    slot->key = key;
+    slot->id = id;
+    slot->body = body;
+    ++t->used;
+}
+
+
+//=//// ENCODING //////////////////////////////////////////////////////////=//
+
+typedef struct {
+    REBSER *bin;  // unmanaged until the encoding is finished
+    struct Rebin_Table symbols;
+    struct Rebin_Table series;
+} REBIN_ENCODER;
+
+static void Encode_Value(REBIN_ENCODER *e, const RELVAL *v);
+
+static REBYTE *Reserve_Rebin_Bytes(REBIN_ENCODER *e, REBLEN n)
+{
+    REBLEN len = BIN_LEN(e->bin);
+    EXPAND_SERIES_TAIL(e->bin, n);
+    return BIN_AT(e->bin, len);
+}
+
+static void Write_Byte(REBIN_ENCODER *e, REBYTE b)
+  { *Reserve_Rebin_Bytes(e, 1) = b; }
+
+static void Write_Bytes(REBIN_ENCODER *e, const REBYTE *p, REBLEN n)
+{
+    if (n != 0)
+        memcpy(Reserve_Rebin_Bytes(e, n), p, n);
+}
+
+// Unsigned LEB128: 7 bits per byte, high bit set if more bytes follow.
+//
+static void Write_Varint(REBIN_ENCODER *e, REBU64 u)
+{
+    REBLEN len = BIN_LEN(e->bin);
+    REBYTE *bp = Reserve_Rebin_Bytes(e, 10);  // most a REBU64 can take
+    REBLEN n = 0;
+    while (u >= 0x80) {
+        bp[n++] = cast(REBYTE, u) | 0x80;
+        u >>= 7;
+    }
+    bp[n++] = cast(REBYTE, u);
+    SET_SERIES_USED(e->bin, len + n);
+}
+
+// Signed numbers are "zigzag" mapped, so small negatives stay short.
+//
+static void Write_Signed(REBIN_ENCODER *e, REBI64 i)
+{
+    Write_Varint(e, (cast(REBU64, i) << 1) ^ cast(REBU64, i >> 63));
+}
+
+static void Write_Decimal(REBIN_ENCODER *e, REBDEC d)
+{
+    REBU64 u;
+    memcpy(&u, &d, sizeof(u));
+
+    REBYTE *bp = Reserve_Rebin_Bytes(e, 8);  // little endian IEEE 754
+    REBLEN n;
+    for (n = 0; n < 8; ++n, u >>= 8)
+        bp[n] = cast(REBYTE, u);
+}
+
+// A series position can be past the tail if the series was shortened after
+// the value was made.  Such positions act like the tail, so write the tail.
+//
+static void Write_Index(REBIN_ENCODER *e, REBLEN index, REBLEN len)
+  { Write_Varint(e, index > len ? len : index); }
+
+// A spelling is written as its 1-based index if it was seen before, else as
+// a 0 followed by its UTF-8 (it then gets the next index).
+//
+static void Write_Symbol(REBIN_ENCODER *e, REBSTR *spelling)
+{
+    struct Rebin_Slot *slot = Find_Rebin_Slot(&e->symbols, spelling);
+    if (slot->key != nullptr) {
+        Write_Varint(e, slot->id);
+        return;
+    }
+    Add_Rebin_Slot(&e->symbols, spelling, ++e->symbols.count, REB_0);
+
+    REBSIZ size = STR_SIZE(spelling);
+    Write_Varint(e, 0);
+    Write_Varint(e, size);
+    Write_Bytes(e, cb_cast(STR_UTF8(spelling)), size);
+}
+
+// Series bodies are written like spellings: an index if the series was
+// seen before, else a 0 and the body.  `body` is the archetypal kind of the
+// body written (REB_BINARY, REB_TEXT, REB_BITSET, REB_BLOCK, REB_MAP or
+// REB_OBJECT).  A series seen again as a different body (e.g. a TEXT! that
+// was aliased AS BINARY!) is just written again.
+//
+static void Write_Series(REBIN_ENCODER *e, REBSER *s, enum Reb_Kind body)
+{
+    struct Rebin_Slot *slot = Find_Rebin_Slot(&e->series, s);
+    if (slot->key != nullptr and slot->body == body) {
+        Write_Varint(e, slot->id);
+        return;
+    }
+
+    // The id is taken before the body is written, so the contents of the
+    // body can refer back to it (the decoder registers it the same way).
+    //
+    REBLEN id = ++e->series.count;
+    if (slot->key == nullptr)
+        Add_Rebin_Slot(&e->series, s, id, body);
+
+    Write_Varint(e, 0);
+
+    switch (body) {
+      case REB_BINARY:
+        Write_Varint(e, BIN_LEN(s));
+        Write_Bytes(e, BIN_HEAD(s), BIN_LEN(s));
+        break;
+
+      case REB_TEXT:
+        Write_Varint(e, STR_SIZE(STR(s)));
+        Write_Bytes(e, BIN_HEAD(s), STR_SIZE(STR(s)));
+        break;
+
+      case REB_BITSET:
+        Write_Byte(e, BITS_NOT(s) ? 1 : 0);
+        Write_Varint(e, BIN_LEN(s));
+        Write_Bytes(e, BIN_HEAD(s), BIN_LEN(s));
+        break;
+
+      case REB_BLOCK: {
+        REBARR *a = ARR(s);
+        Write_Varint(e, ARR_LEN(a));
+        Write_Byte(e, GET_ARRAY_FLAG(a, NEWLINE_AT_TAIL) ? 1 : 0);
+
+        RELVAL *item = ARR_HEAD(a);
+        for (; NOT_END(item); ++item)
+            Encode_Value(e, item);
+        break; }
+
+      case REB_MAP: {  // zombie entries (null values) are left out
+        REBARR *pairlist = ARR(s);
+        REBLEN count = 0;
+        RELVAL *key = ARR_HEAD(pairlist);
+        for (; NOT_END(key); key += 2) {
+            if (not IS_NULLED(key + 1))
+                ++count;
+        }
+        Write_Varint(e, count);
+
+        key = ARR_HEAD(pairlist);
+        for (; NOT_END(key); key += 2) {
+            if (IS_NULLED(key + 1))
+                continue;
+            Encode_Value(e, key);
+            Encode_Value(e, key + 1);
+        }
+        break; }
+
+      case REB_OBJECT: {  // all keys come first, see Read_Series()
+        REBCTX *c = CTX(s);
+        Write_Varint(e, CTX_LEN(c));
+
+        REBVAL *key = CTX_KEYS_HEAD(c);
+        for (; NOT_END(key); ++key) {
+            Write_Byte(e, Is_Param_Hidden(key) ? 1 : 0);
+            Write_Symbol(e, VAL_KEY_SPELLING(key));
+        }
+
+        REBVAL *var = CTX_VARS_HEAD(c);
+        for (; NOT_END(var); ++var)
+            Encode_Value(e, var);
+        break; }
+
+      default:
+        assert(false);
+    }
+}
+
+static void Encode_Value(REBIN_ENCODER *e, const RELVAL *v)
+{
+    if (C_STACK_OVERFLOWING(&e))
+        Fail_Stack_Overflow();  // arrays nested deeper than the C stack
+
+    REBLEN depth = VAL_NUM_QUOTES(v);
+    const REBCEL *cell = VAL_UNESCAPED(v);
+    enum Reb_Kind kind = CELL_KIND(cell);
+
+    REBYTE code = Rebin_Codes[kind];
+    if (code == 0)
+        fail (Error_Invalid_Type(kind));
+
+    REBYTE tag = code;
+    if (GET_CELL_FLAG(v, NEWLINE_BEFORE))
+        tag |= REBIN_TAG_NEWLINE;
+    if (depth != 0)
+        tag |= REBIN_TAG_QUOTED;
+    Write_Byte(e, tag);
+    if (depth != 0)
+        Write_Varint(e, depth);
+
+    switch (kind) {
+      case REB_NULLED:
+      case REB_VOID:
+      case REB_BLANK:
+        break;
+
+      case REB_LOGIC:
+        Write_Byte(e, VAL_LOGIC(cell) ? 1 : 0);
+        break;
+
+      case REB_INTEGER:
+        Write_Signed(e, VAL_INT64(cell));
+        break;
+
+      case REB_DECIMAL:
+      case REB_PERCENT:
+        Write_Decimal(e, VAL_DECIMAL(cell));
+        break;
+
+      case REB_MONEY: {
+        deci amount = VAL_MONEY_AMOUNT(cell);
+        Write_Varint(e, amount.m0);
+        Write_Varint(e, amount.m1);
+        Write_Varint(e, amount.m2);
+        Write_Byte(e, amount.s ? 1 : 0);
+        Write_Byte(e, cast(REBYTE, amount.e));
+        break; }
+
+      case REB_CHAR:
+        Write_Varint(e, VAL_CHAR(cell));
+        break;
+
+      case REB_TIME:
+        Write_Signed(e, VAL_NANO(cell));
+        break;
+
+      case REB_DATE:
+        Write_Varint(e, VAL_YEAR(cell));
+        Write_Byte(e, VAL_MONTH(cell));
+        Write_Byte(e, VAL_DAY(cell));
+        if (not Does_Date_Have_Time(cell))
+            Write_Byte(e, 0);
+        else {
+            Write_Byte(e, Does_Date_Have_Zone(cell) ? 2 : 1);
+            Write_Signed(e, VAL_NANO(cell));
+            if (Does_Date_Have_Zone(cell))
+                Write_Signed(e, VAL_ZONE(cell));
+        }
+        break;
+
+      case REB_PAIR:
+        Encode_Value(e, VAL_PAIR_X(cell));
+        Encode_Value(e, VAL_PAIR_Y(cell));
+        break;
+
+      case REB_TUPLE:
+        Write_Byte(e, VAL_TUPLE_LEN(cell));
+        Write_Bytes(e, VAL_TUPLE(cell), VAL_TUPLE_LEN(cell));
+        break;
+
+      case REB_DATATYPE:  // by name, the kind numbers may differ on decode
+        if (VAL_TYPE_KIND_OR_CUSTOM(cell) == REB_CUSTOM)
+            fail (Error_Invalid_Type(REB_CUSTOM));
+        Write_Symbol(e, Canon(VAL_TYPE_SYM(cell)));
+        break;
+
+      case REB_BITSET:
+        Write_Series(e, VAL_BITSET(cell), REB_BITSET);
+        break;
+
+      case REB_BINARY:
+        Write_Index(e, VAL_INDEX(cell), BIN_LEN(VAL_SERIES(cell)));
+        Write_Series(e, VAL_SERIES(cell), REB_BINARY);
+        break;
+
+      case REB_TEXT:
+      case REB_FILE:
+      case REB_EMAIL:
+      case REB_URL:
+      case REB_TAG:
+      case REB_ISSUE:
+        Write_Index(e, VAL_INDEX(cell), STR_LEN(STR(VAL_SERIES(cell))));
+        Write_Series(e, VAL_SERIES(cell), REB_TEXT);
+        break;
+
+      case REB_WORD:
+      case REB_SET_WORD:
+      case REB_GET_WORD:
+      case REB_SYM_WORD: {
+        Write_Symbol(e, VAL_WORD_SPELLING(cell));
+
+        // A binding can only be kept if it's to an object which was already
+        // written (e.g. the words in an object's own body).  Bindings to
+        // anything else (LIB, function frames) come back unbound, as LOAD
+        // would give them.
+        //
+        REBLEN ctx_id = 0;
+        REBNOD *binding = VAL_BINDING(cell);
+        if (
+            binding
+            and not IS_RELATIVE(cell)
+            and (binding->header.bits & ARRAY_FLAG_IS_VARLIST)
+        ){
+            struct Rebin_Slot *slot = Find_Rebin_Slot(&e->series, binding);
+            if (slot->key != nullptr and slot->body == REB_OBJECT)
+                ctx_id = slot->id;
+        }
+        Write_Varint(e, ctx_id);
+        if (ctx_id != 0)
+            Write_Varint(e, VAL_WORD_INDEX(cell));
+        break; }
+
+      case REB_BLOCK:
+      case REB_SET_BLOCK:
+      case REB_GET_BLOCK:
+      case REB_SYM_BLOCK:
+      case REB_GROUP:
+      case REB_SET_GROUP:
+      case REB_GET_GROUP:
+      case REB_SYM_GROUP:
+      case REB_PATH:
+      case REB_SET_PATH:
+      case REB_GET_PATH:
+      case REB_SYM_PATH:
+        Write_Index(e, VAL_INDEX(cell), ARR_LEN(VAL_ARRAY(cell)));
+        Write_Series(e, SER(VAL_ARRAY(cell)), REB_BLOCK);
+        break;
+
+      case REB_MAP:
+        Write_Series(e, SER(MAP_PAIRLIST(VAL_MAP(cell))), REB_MAP);
+        break;
+
+      case REB_OBJECT:
+        Write_Series(e, SER(CTX_VARLIST(VAL_CONTEXT(cell))), REB_OBJECT);
+        break;
+
+      default:
+        assert(false);
+    }
+}
+
+
+//=//// DECODING //////////////////////////////////////////////////////////=//
+
+typedef struct {
+    const REBYTE *bp;
+    const REBYTE *ep;
+    REBARR *symbols;  // a WORD! for each spelling, in order of appearance
+    REBARR *series;  // a value for each series body, in order of appearance
+} REBIN_DECODER;
+
+static void Decode_Value(REBIN_DECODER *d, RELVAL *out);
+
+static REBYTE Read_Byte(REBIN_DECODER *d)
+{
+    if (d->bp == d->ep)
+        fail (Error_Bad_Media_Raw());
+    return *d->bp++;
+}
+
+static const REBYTE *Read_Bytes(REBIN_DECODER *d, REBLEN n)
+{
+    if (n > cast(REBLEN, d->ep - d->bp))
+        fail (Error_Bad_Media_Raw());
+    const REBYTE *bp = d->bp;
+    d->bp += n;
+    return bp;
+}
+
+static REBU64 Read_Varint(REBIN_DECODER *d)
+{
+    REBU64 u = 0;
+    REBLEN shift = 0;
+    while (true) {
+        REBYTE b = Read_Byte(d);
+        if (shift == 63 and (b & 0x7E))  // only 1 bit left in a REBU64
+            fail (Error_Bad_Media_Raw());
+        u |= cast(REBU64, b & 0x7F) << shift;
+        if (not (b & 0x80))
+            return u;
+        shift += 7;
+        if (shift > 63)
+            fail (Error_Bad_Media_Raw());
+    }
+}
+
+static REBI64 Read_Signed(REBIN_DECODER *d)
+{
+    REBU64 u = Read_Varint(d);
+    return cast(REBI64, (u >> 1) ^ (0 - (u & 1)));
+}
+
+// A count of items which each take at least `min_size` bytes of input, so
+// a corrupt count can't ask for a giant allocation.
+//
+static REBLEN Read_Count(REBIN_DECODER *d, REBLEN min_size)
+{
+    REBU64 n = Read_Varint(d);
+    if (n > cast(REBU64, d->ep - d->bp) / min_size)
+        fail (Error_Bad_Media_Raw());
+    return cast(REBLEN, n);
+}
+
+static REBDEC Read_Decimal(REBIN_DECODER *d)
+{
+    const REBYTE *bp = Read_Bytes(d, 8);
+    REBU64 u = 0;
+    REBLEN n;
+    for (n = 8; n != 0; --n)
+        u = (u << 8) | bp[n - 1];
+
+    REBDEC dec;
+    memcpy(&dec, &u, sizeof(dec));
+    return dec;
+}
+
+// Codepoint count of UTF-8 from outside, which can't have NUL in it.
+//
+static REBLEN Rebin_Utf8_Length(const REBYTE *utf8, REBSIZ size)
+{
+    REBLEN len = 0;
+    const REBYTE *bp = utf8;
+    REBSIZ bytes_left = size;  // see remarks on Back_Scan_UTF8_Char's 3rd arg
+    for (; bytes_left > 0; --bytes_left, ++bp, ++len) {
+        REBUNI c = *bp;
+        if (c == '\0')
+            fail (Error_Bad_Media_Raw());
+        if (c >= 0x80) {
+            bp = Back_Scan_UTF8_Char(&c, bp, &bytes_left);
+            if (bp == nullptr)
+                fail (Error_Bad_Media_Raw());
+        }
+    }
+    return len;
+}
+
+static REBSTR *Read_Symbol(REBIN_DECODER *d)
+{
+    REBU64 id = Read_Varint(d);
+    if (id != 0) {
+        if (id > ARR_LEN(d->symbols))
+            fail (Error_Bad_Media_Raw());
+        return VAL_WORD_SPELLING(ARR_AT(d->symbols, cast(REBLEN, id) - 1));
+    }
+
+    REBSIZ size = Read_Count(d, 1);
+    const REBYTE *utf8 = Read_Bytes(d, size);
+    if (size == 0)
+        fail (Error_Bad_Media_Raw());
+    Rebin_Utf8_Length(utf8, size);
+
+    REBSTR *spelling = Intern_UTF8_Managed(utf8, size);
+    Init_Word(Alloc_Tail_Array(d->symbols), spelling);  // keeps it alive
+    return spelling;
+}
+
+// Counterpart to Write_Series().  A new body is added to the table as soon
+// as its series exists, so that values inside it can refer back to it.
+//
+static REBSER *Read_Series(REBIN_DECODER *d, enum Reb_Kind body)
+{
+    REBU64 id = Read_Varint(d);
+    if (id != 0) {
+        if (id > ARR_LEN(d->series))
+            fail (Error_Bad_Media_Raw());
+        RELVAL *entry = ARR_AT(d->series, cast(REBLEN, id) - 1);
+        if (VAL_TYPE(entry) != body)
+            fail (Error_Bad_Media_Raw());
+        switch (body) {
+          case REB_BITSET:
+            return VAL_BITSET(entry);
+          case REB_MAP:
+            return SER(MAP_PAIRLIST(VAL_MAP(entry)));
+          case REB_OBJECT:
+            return SER(CTX_VARLIST(VAL_CONTEXT(entry)));
+          default:
+            return VAL_SERIES(entry);
+        }
+    }
+
+    RELVAL *entry = Alloc_Tail_Array(d->series);
+
+    switch (body) {
+      case REB_BINARY: {
+        REBSIZ size = Read_Count(d, 1);
+        REBSER *bin = Make_Binary(size);
+        memcpy(BIN_HEAD(bin), Read_Bytes(d, size), size);
+        TERM_BIN_LEN(bin, size);
+        Init_Binary(entry, bin);
+        return bin; }
+
+      case REB_TEXT: {
+        REBSIZ size = Read_Count(d, 1);
+        const REBYTE *utf8 = Read_Bytes(d, size);
+        REBLEN len = Rebin_Utf8_Length(utf8, size);
+        REBSTR *str = Make_String(size);
+        memcpy(BIN_HEAD(SER(str)), utf8, size);
+        TERM_STR_LEN_SIZE(str, len, size);
+        Init_Text(entry, str);
+        return SER(str); }
+
+      case REB_BITSET: {
+        REBYTE negated = Read_Byte(d);
+        if (negated > 1)
+            fail (Error_Bad_Media_Raw());
+        REBSIZ size = Read_Count(d, 1);
+        REBSER *bset = Make_Bitset(size * 8);
+        memcpy(BIN_HEAD(bset), Read_Bytes(d, size), size);
+        INIT_BITS_NOT(bset, negated == 1);
+        Manage_Series(bset);
+        Init_Bitset(entry, bset);
+        return bset; }
+
+      case REB_BLOCK: {
+        REBLEN len = Read_Count(d, 1);
+        REBYTE flags = Read_Byte(d);
+        if (flags > 1)
+            fail (Error_Bad_Media_Raw());
+
+        REBARR *a = Make_Array_Core(
+            len,
+            NODE_FLAG_MANAGED | (flags ? ARRAY_FLAG_NEWLINE_AT_TAIL : 0)
+        );
+        Init_Block(entry, a);
+
+        // The capacity was preallocated, so cells can be decoded in place.
+        //
+        REBLEN n;
+        for (n = 0; n < len; ++n) {
+            RELVAL *item = Init_Blank(Alloc_Tail_Array(a));
+            Decode_Value(d, item);
+            if (IS_NULLED(item))
+                fail (Error_Bad_Media_Raw());
+        }
+        return SER(a); }
+
+      case REB_MAP: {
+        REBLEN count = Read_Count(d, 2);
+        REBMAP *map = Make_Map(count);
+        Init_Map(entry, map);
+
+        DECLARE_LOCAL (key);
+        DECLARE_LOCAL (value);
+        Init_Blank(key);
+        Init_Blank(value);
+        PUSH_GC_GUARD(key);
+        PUSH_GC_GUARD(value);
+
+        REBLEN n;
+        for (n = 0; n < count; ++n) {
+            Decode_Value(d, key);
+            Decode_Value(d, value);
+            if (IS_NULLED(key) or IS_NULLED(value))
+                fail (Error_Bad_Media_Raw());
+            Find_Map_Entry(map, key, SPECIFIED, value, SPECIFIED, true);
+        }
+
+        DROP_GC_GUARD(value);
+        DROP_GC_GUARD(key);
+        return SER(MAP_PAIRLIST(map)); }
+
+      case REB_OBJECT: {
+        //
+        // The keys are all read before any values, so the context can be
+        // complete (with void variables) before anything refers to it.
+        //
+        REBLEN len = Read_Count(d, 3);  // hidden flag, key, and value
+        REBCTX *c = Alloc_Context_Core(REB_OBJECT, len, NODE_FLAG_MANAGED);
+
+        REBVAL *key = CTX_KEYS_HEAD(c);
+        REBVAL *var = CTX_VARS_HEAD(c);
+        REBLEN n;
+        for (n = 0; n < len; ++n, ++key, ++var) {
+            REBYTE hidden = Read_Byte(d);
+            if (hidden > 1)
+                fail (Error_Bad_Media_Raw());
+            Init_Context_Key(key, Read_Symbol(d));
+            if (hidden)
+                TYPE_SET(key, REB_TS_HIDDEN);
+            Init_Void(var);
+        }
+        TERM_ARRAY_LEN(CTX_VARLIST(c), len + 1);
+        TERM_ARRAY_LEN(CTX_KEYLIST(c), len + 1);
+
+        struct Reb_Binder binder;  // no duplicate keys
+        INIT_BINDER(&binder);
+        bool duplicate = false;
+        for (key = CTX_KEYS_HEAD(c), n = 1; NOT_END(key); ++key, ++n) {
+            if (not Try_Add_Binder_Index(&binder, VAL_KEY_CANON(key), n))
+                duplicate = true;
+        }
+        for (key = CTX_KEYS_HEAD(c); NOT_END(key); ++key)
+            Remove_Binder_Index_Else_0(&binder, VAL_KEY_CANON(key));
+        SHUTDOWN_BINDER(&binder);
+
+        if (duplicate)
+            fail (Error_Bad_Media_Raw());
+
+        Init_Object(entry, c);
+
+        for (n = 1; n <= len; ++n)
+            Decode_Value(d, CTX_VAR(c, n));
+        return SER(CTX_VARLIST(c)); }
+
+      default:
+        assert(false);
+        fail (Error_Bad_Media_Raw());
+    }
+}
+
+static void Decode_Value(REBIN_DECODER *d, RELVAL *out)
+{
+    if (C_STACK_OVERFLOWING(&d))
+        Fail_Stack_Overflow();  // nesting in corrupt data can be any depth
+
+    REBYTE tag = Read_Byte(d);
+    REBYTE code = tag & REBIN_CODE_MASK;
+    if (code == 0 or code >= REBIN_NUM_CODES)
+        fail (Error_Bad_Media_Raw());
+    enum Reb_Kind kind = Rebin_Kinds[code];
+
+    REBU64 depth = 0;
+    if (tag & REBIN_TAG_QUOTED) {
+        depth = Read_Varint(d);
+        if (depth == 0 or depth > UINT32_MAX or kind == REB_NULLED)
+            fail (Error_Bad_Media_Raw());
+    }
+
+    switch (kind) {
+      case REB_NULLED:
+        Init_Nulled(out);
+        break;
+
+      case REB_VOID:
+        Init_Void(out);
+        break;
+
+      case REB_BLANK:
+        Init_Blank(out);
+        break;
+
+      case REB_LOGIC: {
+        REBYTE b = Read_Byte(d);
+        if (b > 1)
+            fail (Error_Bad_Media_Raw());
+        Init_Logic(out, b == 1);
+        break; }
+
+      case REB_INTEGER:
+        Init_Integer(out, Read_Signed(d));
+        break;
+
+      case REB_DECIMAL:
+        Init_Decimal(out, Read_Decimal(d));
+        break;
+
+      case REB_PERCENT:
+        Init_Percent(out, Read_Decimal(d));
+        break;
+
+      case REB_MONEY: {
+        REBU64 m0 = Read_Varint(d);
+        REBU64 m1 = Read_Varint(d);
+        REBU64 m2 = Read_Varint(d);
+        REBYTE s = Read_Byte(d);
+        REBYTE e = Read_Byte(d);
+        if (m0 > UINT32_MAX or m1 > UINT32_MAX or m2 >= (1 << 23) or s > 1)
+            fail (Error_Bad_Media_Raw());
+
+        deci amount;
+        amount.m0 = cast(uint32_t, m0);
+        amount.m1 = cast(uint32_t, m1);
+        amount.m2 = cast(uint32_t, m2);
+        amount.s = s;
+        amount.e = cast(signed char, e);
+        Init_Money(out, amount);
+        break; }
+
+      case REB_CHAR: {
+        REBU64 c = Read_Varint(d);
+        if (c > MAX_UNI)
+            fail (Error_Bad_Media_Raw());
+        Init_Char_Unchecked(out, cast(REBUNI, c));
+        break; }
+
+      case REB_TIME:
+        Init_Time_Nanoseconds(out, Read_Signed(d));
+        break;
+
+      case REB_DATE: {
+        REBU64 year = Read_Varint(d);
+        REBYTE month = Read_Byte(d);
+        REBYTE day = Read_Byte(d);
+        REBYTE has = Read_Byte(d);  // 0 date only, 1 time, 2 time and zone
+        if (
+            year > MAX_YEAR or month < 1 or month > 12 or day < 1 or day > 31
+            or has > 2
+        ){
+            fail (Error_Bad_Media_Raw());
+        }
+
+        REBI64 nano = NO_DATE_TIME;
+        REBI64 zone = NO_DATE_ZONE;
+        if (has != 0) {
+            nano = Read_Signed(d);
+            if (nano < 0 or nano >= TIME_IN_DAY)
+                fail (Error_Bad_Media_Raw());
+        }
+        if (has == 2) {
+            zone = Read_Signed(d);
+            if (zone < -MAX_ZONE or zone > MAX_ZONE)
+                fail (Error_Bad_Media_Raw());
+        }
+
+        RESET_CELL(out, REB_DATE, CELL_MASK_NONE);
+        VAL_YEAR(out) = cast(unsigned, year);
+        VAL_MONTH(out) = month;
+        VAL_DAY(out) = day;
+        VAL_DATE(out).zone = cast(int, zone);
+        PAYLOAD(Time, out).nanoseconds = nano;
+        break; }
+
+      case REB_PAIR: {
+        DECLARE_LOCAL (x);
+        DECLARE_LOCAL (y);
+        Decode_Value(d, x);
+        Decode_Value(d, y);
+        if (
+            not (IS_INTEGER(x) or IS_DECIMAL(x))
+            or not (IS_INTEGER(y) or IS_DECIMAL(y))
+        ){
+            fail (Error_Bad_Media_Raw());
+        }
+        Init_Pair(out, x, y);
+        break; }
+
+      case REB_TUPLE: {
+        REBYTE len = Read_Byte(d);
+        if (len > MAX_TUPLE)
+            fail (Error_Bad_Media_Raw());
+        Init_Tuple(out, Read_Bytes(d, len), len);
+        break; }
+
+      case REB_DATATYPE: {
+        REBSYM sym = STR_SYMBOL(Read_Symbol(d));
+        if (not IS_KIND_SYM(sym))
+            fail (Error_Bad_Media_Raw());
+        enum Reb_Kind type = KIND_FROM_SYM(sym);
+        if (type <= REB_NULLED or type == REB_CUSTOM)
+            fail (Error_Bad_Media_Raw());
+        Init_Builtin_Datatype(out, type);
+        break; }
+
+      case REB_BITSET:
+        Init_Bitset(out, Read_Series(d, REB_BITSET));
+        break;
+
+      case REB_BINARY: {
+        REBU64 index = Read_Varint(d);
+        REBSER *bin = Read_Series(d, REB_BINARY);
+        if (index > BIN_LEN(bin))
+            fail (Error_Bad_Media_Raw());
+        Init_Binary_At(out, bin, cast(REBLEN, index));
+        break; }
+
+      case REB_TEXT:
+      case REB_FILE:
+      case REB_EMAIL:
+      case REB_URL:
+      case REB_TAG:
+      case REB_ISSUE: {
+        REBU64 index = Read_Varint(d);
+        REBSTR *str = STR(Read_Series(d, REB_TEXT));
+        if (index > STR_LEN(str))
+            fail (Error_Bad_Media_Raw());
+        Init_Any_String_At(out, kind, str, cast(REBLEN, index));
+        break; }
+
+      case REB_WORD:
+      case REB_SET_WORD:
+      case REB_GET_WORD:
+      case REB_SYM_WORD: {
+        REBSTR *spelling = Read_Symbol(d);
+        REBU64 ctx_id = Read_Varint(d);
+        if (ctx_id == 0) {
+            Init_Any_Word(out, kind, spelling);
+            break;
+        }
+
+        if (ctx_id > ARR_LEN(d->series))
+            fail (Error_Bad_Media_Raw());
+        RELVAL *entry = ARR_AT(d->series, cast(REBLEN, ctx_id) - 1);
+        if (not IS_OBJECT(entry))
+            fail (Error_Bad_Media_Raw());
+        REBCTX *c = VAL_CONTEXT(entry);
+
+        REBU64 index = Read_Varint(d);
+        if (
+            index == 0 or index > CTX_LEN(c)
+            or VAL_KEY_CANON(CTX_KEY(c, cast(REBLEN, index)))
+                != STR_CANON(spelling)
+        ){
+            fail (Error_Bad_Media_Raw());
+        }
+        Init_Any_Word_Bound(out, kind, spelling, c, cast(REBLEN, index));
+        break; }
+
+      case REB_BLOCK:
+      case REB_SET_BLOCK:
+      case REB_GET_BLOCK:
+      case REB_SYM_BLOCK:
+      case REB_GROUP:
+      case REB_SET_GROUP:
+      case REB_GET_GROUP:
+      case REB_SYM_GROUP: {
+        REBU64 index = Read_Varint(d);
+        REBARR *a = ARR(Read_Series(d, REB_BLOCK));
+        if (index > ARR_LEN(a))
+            fail (Error_Bad_Media_Raw());
+        Init_Any_Array_At(out, kind, a, cast(REBLEN, index));
+        break; }
+
+      case REB_PATH:
+      case REB_SET_PATH:
+      case REB_GET_PATH:
+      case REB_SYM_PATH: {
+        REBU64 index = Read_Varint(d);
+        REBARR *a = ARR(Read_Series(d, REB_BLOCK));
+        if (index != 0 or ARR_LEN(a) < 2)
+            fail (Error_Bad_Media_Raw());
+
+        RELVAL *item = ARR_HEAD(a);
+        for (; NOT_END(item); ++item) {
+            if (ANY_PATH(item))  // paths can't be put in paths
+                fail (Error_Bad_Media_Raw());
+        }
+        Init_Any_Path(out, kind, a);
+        break; }
+
+      case REB_MAP:
+        Init_Map(out, MAP(Read_Series(d, REB_MAP)));
+        break;
+
+      case REB_OBJECT:
+        Init_Object(out, CTX(Read_Series(d, REB_OBJECT)));
+        break;
+
+      default:
+        assert(false);
+        fail (Error_Bad_Media_Raw());
+    }
+
+    if (depth != 0)
+        Quotify(out, cast(REBLEN, depth));
+    if (tag & REBIN_TAG_NEWLINE)
+        SET_CELL_FLAG(out, NEWLINE_BEFORE);
+}
+
+
+//
+//  identify-rebin?: native [
+//
+//  {Codec for identifying BINARY! data for a REBIN file}
+//
+//      return: [logic!]
+//      data [binary!]
+//  ]
+//
+REBNATIVE(identify_rebin_q)
+{
+    REBIN_INCLUDE_PARAMS_OF_IDENTIFY_REBIN_Q;
+
+    return Init_Logic(
+        D_OUT,
+        Has_Rebin_Header(VAL_BIN_AT(ARG(data)), VAL_LEN_AT(ARG(data)))
+    );
+}
+
+
+//
+//  decode-rebin: native [
+//
+//  {Codec for decoding BINARY! data for a REBIN file}
+//
+//      return: [any-value!]
+//      data [binary!]
+//  ]
+//
+REBNATIVE(decode_rebin)
+{
+    REBIN_INCLUDE_PARAMS_OF_DECODE_REBIN;
+
+    REBIN_DECODER d;
+    d.bp = VAL_BIN_AT(ARG(data));
+    d.ep = d.bp + VAL_LEN_AT(ARG(data));
+
+    if (not Has_Rebin_Header(d.bp, d.ep - d.bp))
+        fail (Error_Bad_Media_Raw());
+    d.bp += REBIN_HEADER_SIZE;
+
+    d.symbols = Make_Array_Core(16, NODE_FLAG_MANAGED);
+    PUSH_GC_GUARD(d.symbols);
+    d.series = Make_Array_Core(16, NODE_FLAG_MANAGED);
+    PUSH_GC_GUARD(d.series);
+
+    Decode_Value(&d, D_OUT);
+    if (d.bp != d.ep or IS_NULLED(D_OUT))
+        fail (Error_Bad_Media_Raw());
+
+    DROP_GC_GUARD(d.series);
+    DROP_GC_GUARD(d.symbols);
+    return D_OUT;
+}
+
+
+//
+//  encode-rebin: native [
+//
+//  {Codec for encoding a value as a REBIN file}
+//
+//      return: [binary!]
+//      value [any-value!]
+//  ]
+//
+REBNATIVE(encode_rebin)
+{
+    REBIN_INCLUDE_PARAMS_OF_ENCODE_REBIN;
+
+    if (Rebin_Codes[REB_BLOCK] == 0) {
+        REBLEN code;
+        for (code = 1; code < REBIN_NUM_CODES; ++code)
+            Rebin_Codes[Rebin_Kinds[code]] = cast(REBYTE, code);
+    }
+
+    REBIN_ENCODER e;
+    e.bin = Make_Binary(1024);
+    Init_Rebin_Table(&e.symbols);
+    Init_Rebin_Table(&e.series);
+
+    Write_Bytes(&e, Rebin_Magic, sizeof(Rebin_Magic));
+    Write_Byte(&e, REBIN_VERSION);
+    Encode_Value(&e, ARG(value));
+
+    Free_Unmanaged_Series(e.series.slots);
+    Free_Unmanaged_Series(e.symbols.slots);
+
+    TERM_BIN(e.bin);
+    return Init_Binary(D_OUT, e.bin);
+}
@@ -106,6 +106,8 @@ intersect: generic [
     /case "Uses case-sensitive comparison"
     /skip "Treat the series as records of fixed size"
         [integer!]
+    /into "Insert the result into a series (returns position after it)"
+        [any-array! any-string!]
 ]
 
 union: generic [
@@ -124,6 +126,8 @@ union: generic [
     /case "Use case-sensitive comparison"
     /skip "Treat the series as records of fixed size"
         [integer!]
+    /into "Insert the result into a series (returns position after it)"
+        [any-array! any-string!]
 ]
 
 difference: generic [
@@ -144,6 +148,8 @@ difference: generic [
     /case "Uses case-sensitive comparison"
     /skip "Treat the series as records of fixed size"
         [integer!]
+    /into "Insert the result into a series (returns position after it)"
+        [any-array! any-string!]
 ]
 
 
@@ -406,6 +412,8 @@ sort: generic [
         [any-number! any-series!]
     /all "Compare all fields"
     /reverse "Reverse sort order"
+    /key "Compare the results of calling a function once per record"
+        [action!]
 ]
 
 ; Port actions:
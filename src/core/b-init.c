@@ -1218,6 +1218,9 @@ void Startup_Core(void)
     PG_Boot_Level = BOOT_LEVEL_FULL;
     PG_Mem_Usage = 0;
     PG_Mem_Limit = 0;
+    CLEAR(&PG_Mem_Stats, sizeof(REB_MEM_STATS));
+    CLEAR(&PG_Parse_Stats, sizeof(REB_PARSE_STATS));
+    CLEAR(&PG_Scan_Stats, sizeof(REB_SCAN_STATS));
     Reb_Opts = ALLOC(REB_OPTS);
     CLEAR(Reb_Opts, sizeof(REB_OPTS));
     Saved_State = NULL;
@@ -1245,7 +1248,10 @@ void Startup_Core(void)
     Startup_Empty_Array();
 
     Startup_Collector();
+    Startup_Set_Operations();
     Startup_Mold(MIN_COMMON / 4);
+    Startup_Parse();
+    Startup_Find_Index();
 
     Startup_Data_Stack(STACK_MIN / 4);
     Startup_Frame_Stack(); // uses Canon() in FRM_FILE() currently
@@ -1484,11 +1490,14 @@ void Shutdown_Core(void)
     Recycle_Core(shutdown, NULL);
 
     Shutdown_Mold();
+    Shutdown_Set_Operations();
     Shutdown_Collector();
     Shutdown_Raw_Print();
     Shutdown_CRC();
     Shutdown_String();
     Shutdown_Scanner();
+    Shutdown_Find_Index();
+    Shutdown_Parse();
     Shutdown_Char_Cases();
 
     Shutdown_Api();
@@ -83,6 +83,7 @@ void Bind_Values_Inner_Loop(
             (ANY_ARRAY_OR_PATH_KIND(kind))
             and (flags & BIND_DEEP)
         ){
+            Remember_Series_Write(SER(VAL_ARRAY(cell)));  // binding changes
             Bind_Values_Inner_Loop(
                 binder,
                 VAL_ARRAY_AT(cell),
@@ -154,7 +154,9 @@ bool Expand_Context_Keylist_Core(REBCTX *context, REBLEN delta)
             LINK_ANCESTOR_NODE(copy) = LINK_ANCESTOR_NODE(keylist);
 
         Manage_Array(copy);
+        Remember_Series_Write(SER(CTX_VARLIST(context)));  // LINK() changes
         INIT_CTX_KEYLIST_UNIQUE(context, copy);
+        ++TG_Binding_Epoch;  // overrides involving context may have changed
 
         return true;
     }
@@ -213,6 +215,9 @@ REBVAL *Append_Context(
 ) {
     REBARR *keylist = CTX_KEYLIST(context);
 
+    Remember_Series_Write(SER(keylist));  // new key may be a young symbol
+    Remember_Series_Write(SER(CTX_VARLIST(context)));
+
     // Add the key to key list
     //
     // !!! This doesn't seem to consider the shared flag of the keylist (?)
@@ -577,6 +577,7 @@ REB_R MAKE_Error(
         Init_Error(out, error);
 
         Rebind_Context_Deep(root_error, error, NULL); // NULL=>no more binds
+        Remember_Series_Write(SER(VAL_ARRAY(arg)));  // bindings will change
         Bind_Values_Deep(VAL_ARRAY_AT(arg), error);
 
         DECLARE_LOCAL (evaluated);
@@ -100,7 +100,19 @@ bool Do_Signals_Throws(REBVAL *out)
 
     if (filtered_sigs & SIG_RECYCLE) {
         CLR_SIGNAL(SIG_RECYCLE);
-        Recycle();
+        Recycle_Auto();
+    }
+    else if (
+        (saved_sigmask & SIG_RECYCLE)
+        and (GC_Marking or (GC_Sweeping and GC_Budget != 0))
+    ){
+        Recycle_Incremental_Step();  // RECYCLE/BUDGET, one slice per dose
+    }
+
+    if (filtered_sigs & SIG_LAZY_SWEEP) {
+        CLR_SIGNAL(SIG_LAZY_SWEEP);
+        if (GC_Sweeping)  // may have been finished by a recycle since
+            Sweep_Lazily();
     }
 
 #ifdef NOT_USED_INVESTIGATE
@@ -181,6 +181,21 @@ static void Expand_Word_Table(void)
 }
 
 
+// While a sweep is pending (RECYCLE/LAZY or RECYCLE/BUDGET), an interning
+// that wasn't marked may be in a segment the sweep hasn't reached yet.  If
+// it is handed out again it's in use, so it has to be kept like a series
+// managed during the sweep.  The same goes for one a sweep by Make_Node()
+// found dead but left to kill later.  (New internings are kept by
+// Manage_Series().)
+//
+static REBSTR *Keep_Interning_If_Sweeping(REBSTR *intern)
+{
+    if (GC_Sweeping and not (SER(intern)->header.bits & NODE_FLAG_MARKED))
+        Keep_Node_Through_Sweep(NOD(intern));
+    return intern;
+}
+
+
 //
 //  Intern_UTF8_Managed: C
 //
@@ -240,7 +255,7 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
       blockscope {
         REBINT cmp = Compare_UTF8(STR_HEAD(canon), utf8, size);
         if (cmp == 0)
-            return canon;  // was a case-sensitive match
+            return Keep_Interning_If_Sweeping(canon);  // case-sensitive
         if (cmp < 0)
             goto next_candidate_slot;  // wasn't an alternate casing
       }
@@ -257,7 +272,7 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
 
             REBINT cmp = Compare_UTF8(STR_HEAD(synonym), utf8, size);
             if (cmp == 0)
-                return synonym;  // exact match means no new interning
+                return Keep_Interning_If_Sweeping(synonym);  // exact match
 
             assert(cmp > 0);  // at least a synonym if in this list
             synonym = LINK_SYNONYM(synonym);  // look until cycle
@@ -34,8 +34,15 @@
 
 #if !defined(NDEBUG)
 
-#define Is_Marked(n) \
-    (SER(n)->header.bits & NODE_FLAG_MARKED)
+// A minor recycle doesn't mark old series, it assumes they are live.
+//
+static bool Is_Marked(void *n) {
+    if (SER(n)->header.bits & NODE_FLAG_MARKED)
+        return true;
+    if (not GC_Minor or (SER(n)->header.bits & NODE_FLAG_CELL))
+        return false;
+    return GET_SERIES_INFO(SER(n), OLD);
+}
 
 
 //
@@ -229,7 +236,7 @@ void Assert_Cell_Marked_Correctly(const RELVAL *v)
         if (not IS_STR_SYMBOL(STR(s))) {
             REBBMK *bookmark = LINK(s).bookmarks;
             if (bookmark) {
-                assert(not LINK(bookmark).bookmarks);  // just one for now
+                assert(not LINK(bookmark).bookmarks);  // skips are in MISC()
                 //
                 // The intent is that bookmarks are unmanaged REBSERs, which
                 // get freed when the string GCs.  This mechanic could be a by
@@ -238,6 +245,12 @@ void Assert_Cell_Marked_Correctly(const RELVAL *v)
 
                 assert(not Is_Marked(bookmark));
                 assert(NOT_SERIES_FLAG(bookmark, MANAGED));
+
+                REBSER *skips = BMK_SKIPS(bookmark);
+                if (skips) {  // same rules for the skip index
+                    assert(not Is_Marked(skips));
+                    assert(NOT_SERIES_FLAG(skips, MANAGED));
+                }
             }
         }
         break; }
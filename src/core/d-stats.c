@@ -34,10 +34,15 @@
 //
 //  {Provides status and statistics information about the interpreter.}
 //
-//      return: [<opt> time! integer!]
+//      return: [<opt> time! integer! object! block!]
 //      /show "Print formatted results to console"
 //      /profile "Returns profiler object"
 //      /evals "Number of values evaluated by interpreter"
+//      /gc "Returns object with recycle counts and pause times"
+//      /segments "Returns block of objects with each pool's segment usage"
+//      /memory "Returns object with usage, peak, malloc() calls, cache use"
+//      /parse "Returns object with PARSE/MEMO cache lookups and hits"
+//      /scan "Returns object with counts of large inputs scanned in chunks"
 //      /pool "Dump all series in pool"
 //          [integer!]
 //  ]
@@ -51,6 +56,102 @@ REBNATIVE(stats)
         return Init_Integer(D_OUT, n);
     }
 
+    if (REF(gc)) {
+        //
+        // Pause times are gathered in microseconds, but given back as TIME!
+        // so they're easier to read.  TIME! is nanoseconds internally.
+        //
+        return rebValue("make object! [",
+            "minor-recycles:", rebI(GC_Stats.Minor_Recycles),
+            "major-recycles:", rebI(GC_Stats.Major_Recycles),
+            "minor-pause-total: make time!",
+                rebI(GC_Stats.Minor_Pause_Total), "/ 1000000",
+            "minor-pause-max: make time!",
+                rebI(GC_Stats.Minor_Pause_Max), "/ 1000000",
+            "major-pause-total: make time!",
+                rebI(GC_Stats.Major_Pause_Total), "/ 1000000",
+            "major-pause-max: make time!",
+                rebI(GC_Stats.Major_Pause_Max), "/ 1000000",
+            "promoted:", rebI(GC_Stats.Promoted),
+            "remembered:", rebI(GC_Stats.Remembered),
+            "generational:", rebL(GC_Generational),
+            "incremental-recycles:", rebI(GC_Stats.Incremental_Recycles),
+            "slices:", rebI(GC_Stats.Slices),
+            "slice-pause-total: make time!",
+                rebI(GC_Stats.Slice_Pause_Total), "/ 1000000",
+            "slice-pause-max: make time!",
+                rebI(GC_Stats.Slice_Pause_Max), "/ 1000000",
+            "budget: make time!", rebI(GC_Budget), "/ 1000000",
+            "lazy:", rebL(GC_Lazy),
+            "lazy-sweeps:", rebI(GC_Stats.Lazy_Sweeps),
+            "trimmed-bytes:", rebI(GC_Stats.Trimmed_Bytes),
+        "]", rebEND);
+    }
+
+    if (REF(segments)) {
+        //
+        // OCCUPANCY is a histogram of how full the segments are.  The first
+        // number is how many are wholly free, then how many are up to 10%
+        // in use, up to 20%...up to 100%.  (See Pool_Occupancy_Histogram())
+        //
+        REBVAL *pools = rebValue("copy []", rebEND);
+
+        REBLEN n;
+        for (n = 0; n != SYSTEM_POOL; ++n) {
+            REBLEN buckets[11];
+            REBLEN segs = Pool_Occupancy_Histogram(n, buckets);
+
+            REBVAL *occupancy = rebValue("copy []", rebEND);
+            REBLEN i;
+            for (i = 0; i <= 10; ++i)
+                rebElide("append", occupancy, rebI(buckets[i]), rebEND);
+
+            rebElide("append", pools, "make object! [",
+                "wide:", rebI(Mem_Pools[n].wide),
+                "units:", rebI(Mem_Pools[n].units),
+                "segments:", rebI(segs),
+                "used:", rebI(Mem_Pools[n].has - Mem_Pools[n].free),
+                "free:", rebI(Mem_Pools[n].free),
+                "occupancy:", occupancy,
+            "]", rebEND);
+
+            rebRelease(occupancy);
+        }
+
+        return pools;
+    }
+
+    if (REF(memory)) {
+        return rebValue("make object! [",
+            "usage:", rebI(PG_Mem_Usage),
+            "peak:", rebI(PG_Mem_Stats.Peak_Usage),
+            "mallocs:", rebI(PG_Mem_Stats.Mallocs),
+            "frees:", rebI(PG_Mem_Stats.Frees),
+            "cache-hits:", rebI(PG_Mem_Stats.Cache_Hits),
+            "cache-returns:", rebI(PG_Mem_Stats.Cache_Returns),
+            "cached-bytes:", rebI(PG_Mem_Stats.Cached_Bytes),
+        "]", rebEND);
+    }
+
+    if (REF(parse)) {
+        return rebValue("make object! [",
+            "memo-parses:", rebI(PG_Parse_Stats.Memo_Parses),
+            "lookups:", rebI(PG_Parse_Stats.Memo_Lookups),
+            "hits:", rebI(PG_Parse_Stats.Memo_Hits),
+            "stores:", rebI(PG_Parse_Stats.Memo_Stores),
+            "evictions:", rebI(PG_Parse_Stats.Memo_Evictions),
+            "hit-rate: either zero? lookups [0.0] [hits / lookups]",
+        "]", rebEND);
+    }
+
+    if (REF(scan)) {
+        return rebValue("make object! [",
+            "split-scans:", rebI(PG_Scan_Stats.Split_Scans),
+            "chunks:", rebI(PG_Scan_Stats.Chunks),
+            "fallbacks:", rebI(PG_Scan_Stats.Fallbacks),
+        "]", rebEND);
+    }
+
 #ifdef NDEBUG
     UNUSED(REF(show));
     UNUSED(REF(profile));
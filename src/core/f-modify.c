@@ -513,9 +513,12 @@ REBLEN Modify_String_Or_Binary(
         SET_SERIES_USED(dst_ser, dst_used + src_size_total);
 
         if (IS_SER_STRING(dst_ser)) {
-            if (bookmark and BMK_INDEX(bookmark) > dst_idx) {  // only INSERT
-                BMK_INDEX(bookmark) += src_len_total;
-                BMK_OFFSET(bookmark) += src_size_total;
+            if (bookmark) {
+                if (BMK_INDEX(bookmark) > dst_idx) {  // only INSERT
+                    BMK_INDEX(bookmark) += src_len_total;
+                    BMK_OFFSET(bookmark) += src_size_total;
+                }
+                Trim_Bookmark_Skips(bookmark, dst_idx);
             }
             MISC(dst_ser).length = dst_len_old + src_len_total;
         }
@@ -599,10 +602,7 @@ REBLEN Modify_String_Or_Binary(
         // good a cache as any to be relevant for the next operation.
         //
         if (IS_SER_STRING(dst_ser)) {
-            if (bookmark and BMK_INDEX(bookmark) > dst_idx) {
-                BMK_INDEX(bookmark) = dst_idx;
-                BMK_OFFSET(bookmark) = dst_off;
-            }
+            Update_Bookmarks_For_Modify(STR(dst_ser), dst_idx, dst_off);
             MISC(dst_ser).length = dst_len_old + src_len_total - part;
         }
     }
@@ -196,17 +196,18 @@ REB_R Series_Common_Action_Maybe_Unhandled(
         if (IS_BINARY(value))
             return R_UNHANDLED; // !!! unhandled; use bitwise math, for now
 
-        return Init_Any_Series(
-            D_OUT,
-            VAL_TYPE(value),
-            Make_Set_Operation_Series(
-                value,
-                ARG(value2),
-                sop_flags,
-                did REF(case),
-                REF(skip) ? Int32s(ARG(skip), 1) : 1
-            )
-        ); }
+        REBSER *ser = Make_Set_Operation_Series(
+            value,
+            ARG(value2),
+            sop_flags,
+            did REF(case),
+            REF(skip) ? Int32s(ARG(skip), 1) : 1,
+            REF(into) ? ARG(into) : nullptr
+        );
+        if (not ser)
+            RETURN (ARG(into));
+
+        return Init_Any_Series(D_OUT, VAL_TYPE(value), ser); }
 
       default:
         break;
@@ -38,6 +38,7 @@
 //
 
 #include "sys-core.h"
+#include "sys-simd.h"
 
 
 //
@@ -389,6 +390,150 @@ static const REBYTE *Scan_UTF8_Char_Escapable(REBUNI *out, const REBYTE *bp)
 }
 
 
+//=//// BYTE RUN KERNELS //////////////////////////////////////////////////=//
+//
+// Most of the input bytes in a large file are in string bodies, comments, or
+// indentation, where the scanner has nothing to do but step over them.  The
+// kernels below find the end of such a run 16 bytes at a time with SSE2.
+//
+// Input is only known to end at a '\0' byte (see notes on ss->limit), so
+// the vector loads are aligned: an aligned 16-byte load can't cross into
+// another page, so reading past the terminator within its block is safe.
+// Bytes before the first aligned block are checked one at a time, which
+// also means short runs never pay for setting up the vector compares.
+//
+// Address sanitizer doesn't know that, and would report the bytes read past
+// the terminator (e.g. with R3_ALWAYS_MALLOC), so it is turned off for these.
+//
+
+#if defined(REB_SSE2)
+    inline static bool Is_Aligned_16(const REBYTE *cp)
+      { return (cast(uintptr_t, cp) & 15) == 0; }
+#endif
+
+// Bytes that end a plain run inside a string literal: either kind of quote
+// terminator, braces (which nest in {...}), the `^` escape, CR and LF, the
+// end of input, and anything non-ASCII (which has to be decoded).
+//
+inline static bool Is_String_Stop_Byte(REBYTE b) {
+    return b >= 0x80 or b == '"' or b == '{' or b == '}' or b == '^'
+        or b == CR or b == LF or b == '\0';
+}
+
+// Find the end of a run of bytes in a string literal which can be copied to
+// the mold buffer as-is.
+//
+ATTRIBUTE_NO_SANITIZE_ADDRESS
+static const REBYTE *Skip_Plain_String_Bytes(const REBYTE *cp) {
+  #if defined(REB_SSE2)
+    while (not Is_Aligned_16(cp)) {
+        if (Is_String_Stop_Byte(*cp))
+            return cp;
+        ++cp;
+    }
+
+    __m128i quote = _mm_set1_epi8('"');
+    __m128i left = _mm_set1_epi8('{');
+    __m128i right = _mm_set1_epi8('}');
+    __m128i caret = _mm_set1_epi8('^');
+    __m128i cr = _mm_set1_epi8(CR);
+    __m128i lf = _mm_set1_epi8(LF);
+    __m128i zero = _mm_setzero_si128();
+
+    while (true) {
+        __m128i b = _mm_load_si128(cast(const __m128i*, cp));
+        __m128i quotes = _mm_or_si128(
+            _mm_cmpeq_epi8(b, quote),
+            _mm_or_si128(_mm_cmpeq_epi8(b, left), _mm_cmpeq_epi8(b, right))
+        );
+        __m128i others = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(b, caret), _mm_cmpeq_epi8(b, zero)),
+            _mm_or_si128(_mm_cmpeq_epi8(b, cr), _mm_cmpeq_epi8(b, lf))
+        );
+        __m128i stop = _mm_or_si128(quotes, others);
+        unsigned int mask = cast(uint16_t,
+            _mm_movemask_epi8(stop) | _mm_movemask_epi8(b)  // high bit set
+        );
+        if (mask != 0)
+            return cp + Lowest_Set_Bit(mask);
+        cp += 16;
+    }
+  #else
+    while (not Is_String_Stop_Byte(*cp))
+        ++cp;
+    return cp;
+  #endif
+}
+
+// Find the CR, LF, or '\0' which ends a comment.
+//
+ATTRIBUTE_NO_SANITIZE_ADDRESS
+static const REBYTE *Skip_To_Line_End(const REBYTE *cp) {
+  #if defined(REB_SSE2)
+    while (not Is_Aligned_16(cp)) {
+        if (ANY_CR_LF_END(*cp))
+            return cp;
+        ++cp;
+    }
+
+    __m128i cr = _mm_set1_epi8(CR);
+    __m128i lf = _mm_set1_epi8(LF);
+    __m128i zero = _mm_setzero_si128();
+
+    while (true) {
+        __m128i b = _mm_load_si128(cast(const __m128i*, cp));
+        __m128i stop = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(b, cr), _mm_cmpeq_epi8(b, lf)),
+            _mm_cmpeq_epi8(b, zero)
+        );
+        unsigned int mask = cast(uint16_t, _mm_movemask_epi8(stop));
+        if (mask != 0)
+            return cp + Lowest_Set_Bit(mask);
+        cp += 16;
+    }
+  #else
+    while (not ANY_CR_LF_END(*cp))
+        ++cp;
+    return cp;
+  #endif
+}
+
+// Skip whitespace.  Only runs of spaces and tabs (e.g. indentation) are
+// stepped over 16 at a time; other bytes the lexer counts as space (control
+// codes, and bytes which are never valid in UTF-8) are left to the loop.
+//
+ATTRIBUTE_NO_SANITIZE_ADDRESS
+static const REBYTE *Skip_Lex_Spaces(const REBYTE *cp) {
+  #if defined(REB_SSE2)
+    while (not Is_Aligned_16(cp)) {
+        if (not IS_LEX_SPACE(*cp))
+            return cp;
+        ++cp;
+    }
+
+    __m128i space = _mm_set1_epi8(' ');
+    __m128i tab = _mm_set1_epi8('\t');
+
+    while (true) {
+        __m128i b = _mm_load_si128(cast(const __m128i*, cp));
+        __m128i blank = _mm_or_si128(
+            _mm_cmpeq_epi8(b, space), _mm_cmpeq_epi8(b, tab)
+        );
+        unsigned int mask = cast(uint16_t, ~_mm_movemask_epi8(blank));
+        if (mask != 0) {
+            cp += Lowest_Set_Bit(mask);
+            break;
+        }
+        cp += 16;
+    }
+  #endif
+
+    while (IS_LEX_SPACE(*cp))
+        ++cp;
+    return cp;
+}
+
+
 //
 //  Scan_Quote_Push_Mold: C
 //
@@ -396,12 +541,18 @@ static const REBYTE *Scan_UTF8_Char_Escapable(REBUNI *out, const REBYTE *bp)
 // stream might have "a^(1234)b" and need to turn "^(1234)" into the right
 // UTF-8 bytes for that codepoint in the string.
 //
+// Only a string with escapes is put in the mold buffer.  Otherwise the text
+// is the same as the source bytes between the delimiters, so the mold buffer
+// is not pushed and ss->quote_len gets the codepoint count.  The caller can
+// then make the string with a single copy from the source (and a big string
+// literal doesn't grow the mold buffer to its size).
+//
 static const REBYTE *Scan_Quote_Push_Mold(
     REB_MOLD *mo,
     const REBYTE *src,
     SCAN_STATE *ss
 ){
-    Push_Mold(mo);
+    assert(mo->series == nullptr);  // pushed on the first escape, if any
 
     REBUNI term; // pick termination
     if (*src == '{')
@@ -412,9 +563,22 @@ static const REBYTE *Scan_Quote_Push_Mold(
     }
     ++src;
 
+    const REBYTE *head = src;
+    REBLEN len = 0;  // codepoints from head, until the mold is pushed
+
     REBINT nest = 0;
     REBLEN lines = 0;
     while (*src != term or nest > 0) {
+        const REBYTE *plain = Skip_Plain_String_Bytes(src);
+        if (plain != src) {  // a run of ASCII with nothing to escape
+            if (mo->series)
+                Append_Ascii_Len(mo->series, cs_cast(src), plain - src);
+            else
+                len += plain - src;
+            src = plain;
+            continue;
+        }
+
         REBUNI c = *src;
 
         switch (c) {
@@ -425,6 +589,10 @@ static const REBYTE *Scan_Quote_Push_Mold(
             return nullptr;
 
           case '^':
+            if (not mo->series) {  // text now differs from the source
+                Push_Mold(mo);
+                Append_Utf8(mo->series, cs_cast(head), src - head);
+            }
             if ((src = Scan_UTF8_Char_Escapable(&c, src)) == NULL)
                 return NULL;
             --src;  // unlike Back_Scan_XXX, no compensation for ++src later
@@ -449,6 +617,10 @@ static const REBYTE *Scan_Quote_Push_Mold(
             enum Reb_Strmode strmode = STRMODE_NO_CR;
             if (strmode == STRMODE_CRLF_TO_LF) {
                 if (src[1] == LF) {
+                    if (not mo->series) {  // dropping the CR changes text
+                        Push_Mold(mo);
+                        Append_Utf8(mo->series, cs_cast(head), src - head);
+                    }
                     ++src;
                     c = LF;
                     goto linefeed;
@@ -477,10 +649,14 @@ static const REBYTE *Scan_Quote_Push_Mold(
         if (c == '\0')  // e.g. ^(00) or ^@
             fail (Error_Illegal_Zero_Byte_Raw());  // legal CHAR!, not string
 
-        Append_Codepoint(mo->series, c);
+        if (mo->series)
+            Append_Codepoint(mo->series, c);
+        else
+            ++len;
     }
 
     ss->line += lines;
+    ss->quote_len = len;
 
     ++src; // Skip ending quote or brace.
     return src;
@@ -806,8 +982,7 @@ static REBLEN Prescan_Token(SCAN_STATE *ss)
     const REBYTE *cp = ss->begin;
     REBLEN flags = 0;
 
-    while (IS_LEX_SPACE(*cp))  // skip whitespace (if any)
-        ++cp;
+    cp = Skip_Lex_Spaces(cp);  // skip whitespace (if any)
     ss->begin = cp;  // don't count leading whitespace as part of token
 
     while (true) {
@@ -1023,8 +1198,7 @@ static enum Reb_Token Locate_Token_May_Push_Mold(
             panic ("Prescan_Token did not skip whitespace");
 
           case LEX_DELIMIT_SEMICOLON:  // ; begin comment
-            while (not ANY_CR_LF_END(*cp))
-                ++cp;
+            cp = Skip_To_Line_End(cp);
             if (*cp == '\0')
                 return TOKEN_END;  // `load ";"` is [] with no newline on tail
             if (*cp == LF)
@@ -1559,6 +1733,7 @@ void Init_Va_Scan_Level_Core(
 
     ss->file = file;
     ss->depth = 0;
+    ss->quote_len = 0;
 
     // !!! Splicing REBVALs into a scan as it goes creates complexities for
     // error messages based on line numbers.  Fortunately the splice of a
@@ -1598,6 +1773,7 @@ void Init_Scan_Level(
     ss->file = file;
     ss->feed = nullptr;
     ss->depth = 0;
+    ss->quote_len = 0;
 
     out->mode_char = '\0';
     out->start_line_head = ss->line_head = utf8;
@@ -2014,8 +2190,16 @@ REBVAL *Scan_To_Stack(SCAN_LEVEL *level) {
             Init_Char_May_Fail(DS_PUSH(), uni);
             break; }
 
-          case TOKEN_STRING:  // UTF-8 pre-scanned above, and put in MOLD_BUF
-            Init_Text(DS_PUSH(), Pop_Molded_String(mo));
+          case TOKEN_STRING:  // UTF-8 pre-scanned above
+            if (mo->series)  // had escapes, so was decoded into MOLD_BUF
+                Init_Text(DS_PUSH(), Pop_Molded_String(mo));
+            else {  // same as the source, see Scan_Quote_Push_Mold()
+                REBSIZ size = len - 2;  // leave out the delimiters
+                REBSTR *str = Make_String(size);
+                memcpy(BIN_HEAD(SER(str)), bp + 1, size);
+                TERM_STR_LEN_SIZE(str, ss->quote_len, size);
+                Init_Text(DS_PUSH(), str);
+            }
             break;
 
           case TOKEN_BINARY:
@@ -2581,6 +2765,350 @@ static REBARR *Scan_Child_Array(SCAN_LEVEL *parent, REBYTE mode_char)
 }
 
 
+//
+//  Scan_Batches_Into_Array: C
+//
+// Scan all the remaining values at the top level of a scan onto the end of
+// an array.  The values aren't all left on the data stack until the end:
+// they are scanned one at a time with SCAN_FLAG_NEXT, and moved into the
+// array whenever a batch of them has built up.  So the number of top-level
+// values in a large data file is not limited by STACK_LIMIT, and the data
+// stack doesn't grow to hold it all.
+//
+void Scan_Batches_Into_Array(REBARR *a, SCAN_LEVEL *level)
+{
+    assert(level->mode_char == '\0');
+
+    REBDSP dsp_orig = DSP;
+    while (true) {
+        REBDSP dsp_before = DSP;
+        level->opts |= SCAN_FLAG_NEXT;  // Scan_To_Stack() clears it
+        Scan_To_Stack(level);
+
+        bool done = (DSP == dsp_before);  // only TOKEN_END pushes nothing
+        if (done or DSP - dsp_orig >= STACK_MIN / 2) {
+            REBDSP dsp;
+            for (dsp = dsp_orig + 1; dsp <= DSP; ++dsp)
+                Append_Value(a, DS_AT(dsp));
+            DS_DROP_TO(dsp_orig);
+        }
+        if (done)
+            break;
+    }
+}
+
+
+//=//// SPLITTING LARGE INPUTS INTO CHUNKS ////////////////////////////////=//
+//
+// A large input that is many top-level values (like a data file of records)
+// is split into chunks that are scanned independently, and then the values
+// of the chunks are stitched together into one array.  A fast pre-pass finds
+// the splits: line feeds at the top level, outside of any block, group,
+// string, or comment.
+//
+// The pre-pass only tracks the delimiters which the scanner nests, so it can
+// be fooled by a token with an unbalanced one inside it (like the TAG! <]>).
+// But if it splits where the scanner would not have been at the top level,
+// then the chunk ending there is left with an unclosed block, group, or
+// string...which fails to scan.  So if any chunk fails, the whole input is
+// scanned again in one piece.  That gives the same values (or error) as if
+// it had never been split.  The one thing that can span a top-level line
+// feed without an error at the end of a chunk is an apostrophe waiting to
+// quote the next value, so any line where that's possible is not split.
+//
+// The chunks don't depend on each other, so they could be scanned on worker
+// threads.  But allocation, the GC, and the interning of words are not
+// thread-safe, so PG_Scan_Chunks_Hook defaults to Scan_Chunks_Serially().
+//
+
+#define SCAN_CHUNK_SIZE (1024 * 1024)  // bytes scanned before looking to split
+#define SCAN_SPLIT_MIN_SIZE (2 * SCAN_CHUNK_SIZE)  // smaller isn't split
+
+
+//
+//  Find_Scan_Splits: C
+//
+// Pre-pass to split UTF-8 source into chunks of at least SCAN_CHUNK_SIZE
+// bytes, each starting after a top-level line feed.  Fills in the `begin`,
+// `size`, and `line` of up to `max` chunks, and returns how many were found.
+//
+REBLEN Find_Scan_Splits(
+    struct Reb_Scan_Chunk *chunks,
+    REBLEN max,
+    const REBYTE *utf8,
+    REBSIZ size,
+    REBLIN line
+){
+    assert(max >= 1);
+
+    const REBYTE *cp = utf8;
+    const REBYTE *end = utf8 + size;
+
+    REBLEN n = 0;
+    chunks[0].begin = utf8;
+    chunks[0].line = line;
+
+    REBINT depth = 0;  // blocks and groups
+    REBYTE mode = '\0';  // or '"' or '}' in a string, ';' in a comment
+    REBLEN braces = 0;  // nesting of {} in a '}' string
+    bool quote_pending = false;  // a ' may be waiting to quote a value
+    bool quote_held = false;  // ...and a ; was seen after it on this line
+
+    for (; cp != end; ++cp) {
+        REBYTE b = *cp;
+
+        // The apostrophe tracking is done apart from the mode, because a
+        // mistake in the mode could hide an apostrophe and not cause an
+        // error in the chunk it ends.
+        //
+        if (b == '\'')
+            quote_pending = true;
+        else if (b == ';') {
+            if (quote_pending)
+                quote_held = true;
+        }
+        else if (b != ' ' and b != '\t' and b != LF and not quote_held)
+            quote_pending = false;
+
+        if (b == LF) {
+            ++line;
+            if (mode == ';' or mode == '"')  // a " string at LF is an error
+                mode = '\0';
+
+            if (
+                mode == '\0'
+                and depth == 0
+                and not quote_pending
+                and n + 1 < max
+                and cp + 1 - chunks[n].begin >= SCAN_CHUNK_SIZE
+                and cp + 1 != end
+            ){
+                chunks[n].size = cp + 1 - chunks[n].begin;
+                ++n;
+                chunks[n].begin = cp + 1;
+                chunks[n].line = line;
+            }
+
+            quote_pending = false;
+            quote_held = false;
+            continue;
+        }
+
+        switch (mode) {
+          case ';':
+            break;
+
+          case '"':
+            if (b == '^' and cp + 1 != end and cp[1] != LF)
+                ++cp;
+            else if (b == '"')
+                mode = '\0';
+            break;
+
+          case '}':
+            if (b == '^' and cp + 1 != end and cp[1] != LF)
+                ++cp;
+            else if (b == '{')
+                ++braces;
+            else if (b == '}' and --braces == 0)
+                mode = '\0';
+            break;
+
+          default:
+            if (b == '[' or b == '(')
+                ++depth;
+            else if (b == ']' or b == ')') {
+                if (--depth < 0)  // unbalanced, don't trust any more splits
+                    goto finished;
+            }
+            else if (b == '"')
+                mode = '"';
+            else if (b == '{') {
+                mode = '}';
+                braces = 1;
+            }
+            else if (b == ';')
+                mode = ';';
+            break;
+        }
+    }
+
+  finished:
+    chunks[n].size = end - chunks[n].begin;
+    return n + 1;
+}
+
+
+// What Scan_Chunk() passes through rebRescue(), which takes one pointer.
+//
+struct Reb_Chunk_Scan {
+    SCAN_LEVEL level;
+    REBARR *array;
+};
+
+static REBVAL *Scan_Chunk_Rescuable(struct Reb_Chunk_Scan *scan)
+{
+    Scan_Batches_Into_Array(scan->array, &scan->level);
+    return nullptr;
+}
+
+
+//
+//  Scan_Chunk: C
+//
+// Scan the values of one chunk from Find_Scan_Splits() into a new unmanaged
+// array.  The chunk is copied out so it is terminated for the scanner.  If
+// the scan fails, the chunk's `array` is left as nullptr.
+//
+void Scan_Chunk(struct Reb_Scan_Chunk *chunk, REBSTR *file, REBFLGS opts)
+{
+    REBSER *bin = Make_Binary(chunk->size);
+    memcpy(BIN_HEAD(bin), chunk->begin, chunk->size);
+    TERM_BIN_LEN(bin, chunk->size);
+
+    SCAN_STATE ss;
+    struct Reb_Chunk_Scan scan;
+    Init_Scan_Level(
+        &scan.level, &ss, file, chunk->line, BIN_HEAD(bin), chunk->size
+    );
+    scan.level.opts = opts;
+    scan.array = Make_Array(0);  // unmanaged arrays are marked as GC roots
+
+    REBVAL *error = rebRescue(cast(REBDNG*, &Scan_Chunk_Rescuable), &scan);
+
+    Free_Unmanaged_Series(bin);
+
+    if (error) {
+        rebRelease(error);  // fallback to a serial scan will report it
+        Free_Unmanaged_Series(SER(scan.array));
+        chunk->array = nullptr;
+        return;
+    }
+
+    chunk->array = scan.array;
+    chunk->end_line = ss.line;
+    chunk->newline_pending = scan.level.newline_pending;
+}
+
+
+//
+//  Scan_Chunks_Serially: C
+//
+// Default for PG_Scan_Chunks_Hook.  A host with a thread-safe allocator, GC,
+// and interner could instead call Scan_Chunk() on each chunk concurrently.
+//
+void Scan_Chunks_Serially(
+    struct Reb_Scan_Chunk *chunks,
+    REBLEN num_chunks,
+    REBSTR *file,
+    REBFLGS opts
+){
+    REBLEN i;
+    for (i = 0; i < num_chunks; ++i) {
+        Scan_Chunk(&chunks[i], file, opts);
+        if (not chunks[i].array)
+            return;  // no need to scan the rest, it will all be rescanned
+    }
+}
+
+
+// Try scanning a large UTF-8 input in chunks.  Appends the values to `a` and
+// updates the scan state as if it had all been scanned, or returns false
+// (with `a` untouched) if the input couldn't be split or a chunk failed.
+//
+static bool Scanned_In_Chunks(REBARR *a, SCAN_LEVEL *level, REBSIZ size)
+{
+    SCAN_STATE *ss = level->ss;
+    if (ss->feed or size < SCAN_SPLIT_MIN_SIZE)
+        return false;
+
+    REBLEN max = size / SCAN_CHUNK_SIZE;
+    struct Reb_Scan_Chunk *chunks = ALLOC_N(struct Reb_Scan_Chunk, max);
+
+    REBLEN num_chunks = Find_Scan_Splits(
+        chunks, max, ss->begin, size, ss->line
+    );
+    if (num_chunks == 1) {
+        FREE_N(struct Reb_Scan_Chunk, max, chunks);
+        return false;
+    }
+
+    REBLEN i;
+    for (i = 0; i < num_chunks; ++i)
+        chunks[i].array = nullptr;
+
+    PG_Scan_Chunks_Hook(chunks, num_chunks, ss->file, level->opts);
+
+    bool ok = true;
+    for (i = 0; i < num_chunks; ++i) {
+        if (not chunks[i].array)
+            ok = false;
+    }
+
+    ++PG_Scan_Stats.Split_Scans;
+    PG_Scan_Stats.Chunks += num_chunks;
+
+    bool pending = level->newline_pending;
+    for (i = 0; i < num_chunks; ++i) {
+        REBARR *chunk = chunks[i].array;
+        if (not chunk)
+            continue;
+
+        if (ok) {
+            REBLEN len = ARR_LEN(chunk);
+            if (len != 0) {
+                RELVAL *item = ARR_HEAD(chunk);
+                if (pending)  // a line feed ended an earlier chunk
+                    SET_CELL_FLAG(item, NEWLINE_BEFORE);
+
+                for (; NOT_END(item); ++item)
+                    Append_Value(a, KNOWN(item));
+                pending = false;
+            }
+            pending = pending or chunks[i].newline_pending;
+        }
+        Free_Unmanaged_Series(SER(chunk));
+    }
+
+    if (ok) {
+        const struct Reb_Scan_Chunk *last = &chunks[num_chunks - 1];
+        ss->begin = last->begin + last->size;
+        ss->line = last->end_line;
+        level->newline_pending = pending;
+    }
+    else
+        ++PG_Scan_Stats.Fallbacks;
+
+    FREE_N(struct Reb_Scan_Chunk, max, chunks);
+    return ok;
+}
+
+
+//
+//  Scan_To_Array_Managed: C
+//
+// Scan all the values at the top level into a new array.  The `size` is
+// the number of bytes of UTF-8 at ss->begin, which lets a large input be
+// split into chunks (see Find_Scan_Splits()).
+//
+REBARR *Scan_To_Array_Managed(SCAN_LEVEL *level, REBSIZ size)
+{
+    assert(level->mode_char == '\0');
+
+    REBARR *a = Make_Array_Core(0, NODE_FLAG_MANAGED);
+    PUSH_GC_GUARD(a);
+
+    if (not Scanned_In_Chunks(a, level, size))
+        Scan_Batches_Into_Array(a, level);
+
+    if (level->newline_pending)
+        SET_ARRAY_FLAG(a, NEWLINE_AT_TAIL);
+
+    DROP_GC_GUARD(a);
+    return a;
+}
+
+
 //
 //  Scan_UTF8_Managed: C
 //
@@ -2593,14 +3121,7 @@ REBARR *Scan_UTF8_Managed(REBSTR *filename, const REBYTE *utf8, REBSIZ size)
     const REBLIN start_line = 1;
     Init_Scan_Level(&level, &ss, filename, start_line, utf8, size);
 
-    REBDSP dsp_orig = DSP;
-    Scan_To_Stack(&level);
-
-    REBARR *a = Pop_Stack_Values_Core(
-        dsp_orig,
-        NODE_FLAG_MANAGED
-            | (level.newline_pending ? ARRAY_FLAG_NEWLINE_AT_TAIL : 0)
-    );
+    REBARR *a = Scan_To_Array_Managed(&level, size);
 
     MISC(a).line = ss.line;
     LINK_FILE_NODE(a) = NOD(ss.file);
@@ -2652,6 +3173,8 @@ void Startup_Scanner(void)
     while (Token_Names[n])
         ++n;
     assert(cast(enum Reb_Token, n) == TOKEN_MAX);
+
+    PG_Scan_Chunks_Hook = &Scan_Chunks_Serially;
 }
 
 
@@ -2660,6 +3183,7 @@ void Startup_Scanner(void)
 //
 void Shutdown_Scanner(void)
 {
+    PG_Scan_Chunks_Hook = nullptr;
 }
 
 
@@ -2697,6 +3221,12 @@ REBNATIVE(transcode)
 // as it was fairly useless...taking items out of blocks but then would wind
 // up failing when it hit the closing brace on successive calls.  A more
 // coherent notion of continuable scanner state is required.
+//
+// Until then, READ-VALUES streams values from chunked input by keeping the
+// bytes of any value that was cut off by the end of a chunk, and scanning
+// them again with more data.  So a scan is only resumable between top-level
+// values, but that is enough to load big files of many values in constant
+// memory.
 {
     INCLUDE_PARAMS_OF_TRANSCODE;
 
@@ -2742,6 +3272,7 @@ REBNATIVE(transcode)
     // Return a block of the results, so [1] and [[1]] in those cases.
     //
     REBDSP dsp_orig = DSP;
+    REBARR *a = nullptr;
     if (REF(relax)) {
         bool failed = Scan_To_Stack_Relaxed_Failed(&level);
 
@@ -2753,8 +3284,10 @@ REBNATIVE(transcode)
         else
             Init_Nulled(var);
     }
-    else
+    else if (REF(next))
         Scan_To_Stack(&level);
+    else
+        a = Scan_To_Array_Managed(&level, size);
 
     if (REF(next)) {
         if (DSP == dsp_orig)
@@ -2766,11 +3299,13 @@ REBNATIVE(transcode)
         assert(DSP == dsp_orig);
     }
     else {
-        REBARR *a = Pop_Stack_Values_Core(
-            dsp_orig,
-            NODE_FLAG_MANAGED
-                | (level.newline_pending ? ARRAY_FLAG_NEWLINE_AT_TAIL : 0)
-        );
+        if (not a) {  // /RELAX scans to the stack
+            a = Pop_Stack_Values_Core(
+                dsp_orig,
+                NODE_FLAG_MANAGED
+                    | (level.newline_pending ? ARRAY_FLAG_NEWLINE_AT_TAIL : 0)
+            );
+        }
         MISC(a).line = ss.line;
         LINK_FILE_NODE(a) = NOD(ss.file);
         SER(a)->header.bits |= ARRAY_MASK_HAS_FILE_LINE;
@@ -59,6 +59,22 @@
 // nodes used for other purposes.  Review in light of any new garbage collect
 // approaches used.
 //
+// GENERATIONS: A "minor" recycle (see Recycle_Minor()) exploits the fact
+// that most series die young.  Every managed series that survives a recycle
+// gets SERIES_INFO_OLD.  Minor recycles don't trace into old series, and
+// don't free them...so marking work is proportional to the young series
+// reachable from the roots.  To keep that correct, old series that have
+// been written to since the last recycle are put in GC_Remembered by the
+// write barrier (Remember_Series_Write()), and have their contents traced as
+// if they were roots.  A full ("major") recycle still traces everything.
+//
+// !!! Finding the API handles and unmanaged arrays that act as roots still
+// needs a walk of the whole series pool, as does the sweep.  Those walks do
+// not follow pointers, so they're cheaper than marking--but they still grow
+// with the heap size.
+//
+
+#include <time.h>  // clock(), for measuring pause times
 
 #include "sys-core.h"
 
@@ -92,6 +108,8 @@ static void Mark_Devices_Deep(void);
     static bool in_mark = false; // needs to be per-GC thread
 #endif
 
+static REBLEN minors_since_major = 0;
+
 #define ASSERT_NO_GC_MARKS_PENDING() \
     assert(SER_USED(GC_Mark_Stack) == 0)
 
@@ -181,6 +199,9 @@ static void Queue_Mark_Node_Deep(void *p)
     }
 
     REBSER *s = SER(p);
+    if (GC_Minor and GET_SERIES_INFO(s, OLD))
+        return;  // assume live, anything young it refers to is remembered
+
     if (GET_SERIES_INFO(s, INACCESSIBLE)) {
         //
         // !!! All inaccessible nodes should be collapsed and canonized into
@@ -281,20 +302,79 @@ static void Queue_Mark_Opt_End_Cell_Deep(const RELVAL *v)
 
 
 //
-//  Propagate_All_GC_Marks: C
+//  Queue_Mark_Series_Contents: C
+//
+// During a minor recycle, old series are not marked or traced.  But the ones
+// which were written to since the last recycle (or which are roots, like the
+// varlist of a running frame) may refer to young series.  This queues what
+// the series refers to without marking the series itself.
+//
+// It's also used to trace series again that were modified after they were
+// marked by an incremental recycle.
+//
+static void Queue_Mark_Series_Contents(REBSER *s)
+{
+    assert(GC_Minor or GC_Marking);
+
+    if (GET_SERIES_INFO(s, INACCESSIBLE))
+        return;
+
+    if (GET_SERIES_FLAG(s, LINK_NODE_NEEDS_MARK) and LINK(s).custom.node)
+        Queue_Mark_Node_Deep(LINK(s).custom.node);
+
+    if (GET_SERIES_FLAG(s, MISC_NODE_NEEDS_MARK) and MISC(s).custom.node)
+        Queue_Mark_Node_Deep(MISC(s).custom.node);
+
+    if (IS_SER_ARRAY(s)) {
+        RELVAL *v = ARR_HEAD(ARR(s));
+        for (; NOT_END(v); ++v)
+            Queue_Mark_Opt_Value_Deep(v);
+    }
+}
+
+
+// Roots are marked the same way in minor and major recycles, except that if
+// a root is an old series then its contents must be traced explicitly.
+//
+// The same goes for the final slice of an incremental recycle (GC_Marking is
+// still set when it rescans the roots).  Frame varlists and guarded arrays
+// are written without the barrier, so a root that was marked in an earlier
+// slice may hold cells that were stored since, and have to be traced again.
+//
+static void Queue_Mark_Root_Node_Deep(void *p)
+{
+    REBSER *s = SER(p);
+    if (*cast(REBYTE*, p) & NODE_BYTEMASK_0x01_CELL)
+        Queue_Mark_Node_Deep(p);
+    else if (GC_Minor and GET_SERIES_INFO(s, OLD))
+        Queue_Mark_Series_Contents(s);
+    else if (GC_Marking and (s->header.bits & NODE_FLAG_MARKED))
+        Queue_Mark_Series_Contents(s);
+    else
+        Queue_Mark_Node_Deep(p);
+}
+
+
+//
+//  Propagate_GC_Marks_Until: C
 //
 // The Mark Stack is a series containing series pointers.  They have already
 // had their SERIES_FLAG_MARK set to prevent being added to the stack multiple
 // times, but the items they can reach are not necessarily marked yet.
 //
 // Processing continues until all reachable items from the mark stack are
-// known to be marked.
+// known to be marked.  Or if `deadline` isn't 0, it may stop early and return
+// false when the clock passes the deadline (checked every 64 arrays).
 //
-static void Propagate_All_GC_Marks(void)
+static bool Propagate_GC_Marks_Until(clock_t deadline)
 {
     assert(not in_mark);
 
+    REBLEN checks = 0;
     while (SER_USED(GC_Mark_Stack) != 0) {
+        if (deadline != 0 and ++checks % 64 == 0 and clock() >= deadline)
+            return false;
+
         SET_SERIES_USED(GC_Mark_Stack, SER_USED(GC_Mark_Stack) - 1);  // safe
 
         // Data pointer may change in response to an expansion during
@@ -314,6 +394,12 @@ static void Propagate_All_GC_Marks(void)
          //
         assert(SER(a)->header.bits & NODE_FLAG_MARKED);
 
+        // With an incremental recycle, a frame's varlist could have been
+        // queued and then had the frame end before the next slice.
+        //
+        if (GET_SERIES_INFO(a, INACCESSIBLE))
+            continue;
+
         RELVAL *v = ARR_HEAD(a);
         for (; NOT_END(v); ++v) {
             Queue_Mark_Opt_Value_Deep(v);
@@ -338,6 +424,24 @@ static void Propagate_All_GC_Marks(void)
         Assert_Array_Marked_Correctly(a);
       #endif
     }
+
+    return true;
+}
+
+
+// The first slice of an incremental recycle queues the roots without doing
+// the propagation, so that it can be spread across the later slices.
+//
+static bool propagate_later = false;
+
+static void Propagate_All_GC_Marks(void)
+{
+    if (propagate_later)
+        return;
+
+    bool done = Propagate_GC_Marks_Until(0);
+    assert(done);
+    UNUSED(done);
 }
 
 
@@ -681,7 +785,7 @@ static void Mark_Guarded_Nodes(void)
             Queue_Mark_Opt_End_Cell_Deep(cast(REBVAL*, node));
         }
         else  // a series
-            Queue_Mark_Node_Deep(node);
+            Queue_Mark_Root_Node_Deep(node);
 
         Propagate_All_GC_Marks();
     }
@@ -745,7 +849,7 @@ static void Mark_Frame_Stack_Deep(void)
             f->feed->specifier != SPECIFIED
             and (f->feed->specifier->header.bits & NODE_FLAG_MANAGED)
         ){
-            Queue_Mark_Node_Deep(CTX(f->feed->specifier));
+            Queue_Mark_Root_Node_Deep(CTX(f->feed->specifier));
         }
 
         // f->out can be nullptr at the moment, when a frame is created that
@@ -789,7 +893,7 @@ static void Mark_Frame_Stack_Deep(void)
             // partial parameter traversal.
             //
             assert(IS_END(f->param)); // done walking
-            Queue_Mark_Node_Deep(CTX(f->varlist));
+            Queue_Mark_Root_Node_Deep(CTX(f->varlist));
             goto propagate_and_continue;
         }
 
@@ -859,121 +963,372 @@ static void Mark_Frame_Stack_Deep(void)
 
 
 //
-//  Sweep_Series: C
+//  Mark_Remembered_Series: C
 //
-// Scans all series nodes (REBSER structs) in all segments that are part of
-// the SER_POOL.  If a series had its lifetime management delegated to the
-// garbage collector with Manage_Series(), then if it didn't get "marked" as
-// live during the marking phase then free it.
+// Trace the contents of old series that the write barrier has noted may
+// refer to young series.  Only used for minor recycles.
 //
-static REBLEN Sweep_Series(void)
+static void Mark_Remembered_Series(void)
 {
-    REBLEN count = 0;
+    assert(GC_Minor);
 
-    REBSEG *seg = Mem_Pools[SER_POOL].segs;
-    for (; seg != nullptr; seg = seg->next) {
-        REBLEN n = Mem_Pools[SER_POOL].units;
+    REBSER **sp = SER_HEAD(REBSER*, GC_Remembered);
+    REBLEN n = SER_USED(GC_Remembered);
+    for (; n > 0; --n, ++sp) {
+        Queue_Mark_Series_Contents(*sp);
+        Propagate_All_GC_Marks();
+    }
 
-        // We use a generic byte pointer (unsigned char*) to dodge the rules
-        // for strict aliasing, as the pool may contain pairs of REBVAL from
-        // Alloc_Pairing(), or a REBSER from Alloc_Series_Node().  The shared
-        // first byte node masks are defined and explained in %sys-rebnod.h
-        //
-        // NOTE: If you are using a build with UNUSUAL_REBVAL_SIZE such as
-        // DEBUG_TRACK_EXTEND_CELLS, then this will be processing the REBSER
-        // nodes only--see loop lower down for the pairing pool enumeration.
-
-        REBYTE *bp = cast(REBYTE*, seg + 1);
-
-        for (; n > 0; --n, bp += sizeof(REBSER)) {
-            switch (*bp >> 4) {
-              case 0:
-              case 1:  // 0x1
-              case 2:  // 0x2
-              case 3:  // 0x2 + 0x1
-              case 4:  // 0x4
-              case 5:  // 0x4 + 0x1
-              case 6:  // 0x4 + 0x2
-              case 7:  // 0x4 + 0x2 + 0x1
-                //
-                // NODE_FLAG_NODE (0x8) is clear.  This signature is
-                // reserved for UTF-8 strings (corresponding to valid ASCII
-                // values in the first byte).
-                //
-                panic (bp);
+    GC_Stats.Remembered = SER_USED(GC_Remembered);
+}
 
-            // v-- Everything below here has NODE_FLAG_NODE set (0x8)
 
-              case 8:
-                // 0x8: unmanaged and unmarked, e.g. a series that was made
-                // with Make_Series() and hasn't been managed.  It doesn't
-                // participate in the GC.  Leave it as is.
-                //
-                // !!! Are there actually legitimate reasons to do this with
-                // arrays, where the creator knows the cells do not need
-                // GC protection?  Should finding an array in this state be
-                // considered a problem (e.g. the GC ran when you thought it
-                // couldn't run yet, hence would be able to free the array?)
-                //
-                break;
+//
+//  Forget_Remembered_Series: C
+//
+// After a recycle of either kind, all surviving series will be old...so the
+// old-to-young references the remembered set was tracking are gone.  This
+// has to be done before sweeping, while all the remembered nodes are valid.
+//
+static void Forget_Remembered_Series(void)
+{
+    REBSER **sp = SER_HEAD(REBSER*, GC_Remembered);
+    REBLEN n = SER_USED(GC_Remembered);
+    for (; n > 0; --n, ++sp) {
+        assert(GET_SERIES_INFO(*sp, REMEMBERED));
+        CLEAR_SERIES_INFO(*sp, REMEMBERED);
+    }
 
-              case 9:
-                // 0x8 + 0x1: marked but not managed, this can't happen,
-                // because the marking itself asserts nodes are managed.
-                //
-                panic (bp);
+    SET_SERIES_USED(GC_Remembered, 0);
+}
 
-              case 10:
-                // 0x8 + 0x2: managed but didn't get marked, should be GC'd
-                //
-                // !!! It would be nice if we could have NODE_FLAG_CELL here
-                // as part of the switch, but see its definition for why it
-                // is at position 8 from left and not an earlier bit.
-                //
-                if (*bp & NODE_BYTEMASK_0x01_CELL) {
-                    assert(not (*bp & NODE_BYTEMASK_0x04_ROOT));
-                    Free_Node(SER_POOL, NOD(bp));  // Free_Pairing for manuals
+
+#if !defined(NDEBUG)
+
+// A node that the recycle is about to free, which must not be referred to by
+// a series that the recycle considers live.  (Minor recycles don't free old
+// series, nor pairings.)
+//
+static bool Is_Unmarked_Freeable_Node(REBNOD *node)
+{
+    if (node == nullptr)
+        return false;
+    if (not (node->header.bits & NODE_FLAG_MANAGED))
+        return false;
+    if (node->header.bits & NODE_FLAG_MARKED)
+        return false;
+    if (not GC_Minor)
+        return true;
+    if (node->header.bits & NODE_FLAG_CELL)
+        return false;  // pairings are not freed by minor recycles
+    return NOT_SERIES_INFO(SER(node), OLD);
+}
+
+static void Check_Cell_For_Missed_Barrier(REBSER *s, const RELVAL *v)
+{
+    if (CELL_KIND_UNCHECKED(v) < REB_PAIR)
+        return;
+
+    if (
+        IS_BINDABLE_KIND(CELL_KIND_UNCHECKED(v))
+        and EXTRA(Binding, v).node != UNBOUND
+        and Is_Unmarked_Freeable_Node(EXTRA(Binding, v).node)
+    ){
+        panic (s);
+    }
+
+    if (
+        GET_CELL_FLAG(v, FIRST_IS_NODE)
+        and Is_Unmarked_Freeable_Node(PAYLOAD(Any, v).first.node)
+    ){
+        panic (s);
+    }
+
+    if (
+        GET_CELL_FLAG(v, SECOND_IS_NODE)
+        and Is_Unmarked_Freeable_Node(PAYLOAD(Any, v).second.node)
+    ){
+        panic (s);
+    }
+}
+
+//
+//  Verify_No_Missed_Barriers_Debug: C
+//
+// If some code path modifies a series without Remember_Series_Write(), then
+// a minor recycle can free young series that are still referenced from an
+// old series.  An incremental recycle can likewise free series referenced
+// from one that was modified after being marked.
+//
+// This walks every series the recycle is treating as live without looking
+// at it again--old series that weren't remembered for a minor recycle, or
+// all marked series at the end of incremental marking.  It panics on the
+// first one that refers to a series that's going to be freed...so the
+// series panicked on is the one whose modification needed a barrier.
+//
+// This walks the whole heap, so it defeats the purpose of a minor recycle
+// for timing.  But it's only in the debug build.
+//
+static void Verify_No_Missed_Barriers_Debug(void)
+{
+    assert(GC_Minor or GC_Marking);
+
+    REBSEG *seg;
+    for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
+        REBSER *s = cast(REBSER*, seg + 1);
+        REBLEN n;
+        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+            if (IS_FREE_NODE(s))
+                continue;
+            if (s->header.bits & NODE_FLAG_CELL)
+                continue;
+            if (not (s->header.bits & NODE_FLAG_MANAGED))
+                continue;  // unmanaged arrays are traced as roots
+            if (GC_Minor) {
+                if (NOT_SERIES_INFO(s, OLD) or GET_SERIES_INFO(s, REMEMBERED))
+                    continue;
+            }
+            else {
+                if (not (s->header.bits & NODE_FLAG_MARKED))
+                    continue;
+            }
+            if (GET_SERIES_INFO(s, INACCESSIBLE))
+                continue;
+
+            if (
+                GET_SERIES_FLAG(s, LINK_NODE_NEEDS_MARK)
+                and Is_Unmarked_Freeable_Node(LINK(s).custom.node)
+            ){
+                panic (s);
+            }
+            if (
+                GET_SERIES_FLAG(s, MISC_NODE_NEEDS_MARK)
+                and Is_Unmarked_Freeable_Node(MISC(s).custom.node)
+            ){
+                panic (s);
+            }
+
+            if (not IS_SER_ARRAY(s))
+                continue;
+
+            RELVAL *v = ARR_HEAD(ARR(s));
+            for (; NOT_END(v); ++v)
+                Check_Cell_For_Missed_Barrier(s, v);
+        }
+    }
+}
+
+#endif
+
+
+// A sweep done by Make_Node() is "quiet", it only kills series whose freeing
+// just gives back memory (see Sweep_For_Node()).  Others are deferred, and
+// counted as live until Finish_Sweep() kills them.
+//
+static bool sweep_quietly = false;
+static REBSER *deferred_kills;  // dead series a quiet sweep left alone
+
+// Does killing the series run a HANDLE! cleaner, or change the tables of
+// symbols, PARSE programs, or FIND indexes?  (See Decay_Series().)
+//
+static bool Needs_Safe_Point_To_Kill(REBSER *s)
+{
+    if (GET_SERIES_INFO(s, INACCESSIBLE))
+        return false;  // already decayed
+
+    if (GET_SERIES_FLAG(s, IS_STRING))
+        return IS_STR_SYMBOL(STR(s));
+
+    if (not IS_SER_ARRAY(s))
+        return false;
+
+    if (NOT_ARRAY_FLAG(s, IS_PARAMLIST)) {  // these flags mean other things
+        if (GET_ARRAY_FLAG(s, PARSE_COMPILED))
+            return true;
+        if (GET_ARRAY_FLAG(s, FIND_INDEXED))
+            return true;
+    }
+
+    if (IS_SER_DYNAMIC(s))
+        return false;
+
+    RELVAL *v = ARR_HEAD(ARR(s));  // singular array of a managed HANDLE!?
+    return (
+        CELL_KIND_UNCHECKED(v) == REB_HANDLE
+        and VAL_HANDLE_SINGULAR(v) == ARR(s)
+        and MISC(s).cleaner != nullptr
+    );
+}
+
+static void Defer_Kill(REBSER *s)
+{
+    if (SER_FULL(deferred_kills))
+        Extend_Series(deferred_kills, 8);
+    *SER_AT(REBSER*, deferred_kills, SER_USED(deferred_kills)) = s;
+    SET_SERIES_USED(deferred_kills, SER_USED(deferred_kills) + 1);
+}
+
+
+//
+//  Sweep_Series_Segment: C
+//
+// Scans the series nodes (REBSER structs) in one segment of the SER_POOL.
+// If a series had its lifetime management delegated to the garbage collector
+// with Manage_Series(), then if it didn't get "marked" as live during the
+// marking phase then free it.
+//
+// The segment's `live` and `freed` counts are updated.
+//
+static REBLEN Sweep_Series_Segment(REBSEG *seg)
+{
+    REBLEN count = 0;
+    REBLEN live = 0;
+    REBLEN n = Mem_Pools[SER_POOL].units;
+
+    // We use a generic byte pointer (unsigned char*) to dodge the rules
+    // for strict aliasing, as the pool may contain pairs of REBVAL from
+    // Alloc_Pairing(), or a REBSER from Alloc_Series_Node().  The shared
+    // first byte node masks are defined and explained in %sys-rebnod.h
+    //
+    // NOTE: If you are using a build with UNUSUAL_REBVAL_SIZE such as
+    // DEBUG_TRACK_EXTEND_CELLS, then this will be processing the REBSER
+    // nodes only--see Sweep_Pairings() for the pairing pool enumeration.
+
+    REBYTE *bp = cast(REBYTE*, seg + 1);
+
+    for (; n > 0; --n, bp += sizeof(REBSER)) {
+        switch (*bp >> 4) {
+          case 0:
+          case 1:  // 0x1
+          case 2:  // 0x2
+          case 3:  // 0x2 + 0x1
+          case 4:  // 0x4
+          case 5:  // 0x4 + 0x1
+          case 6:  // 0x4 + 0x2
+          case 7:  // 0x4 + 0x2 + 0x1
+            //
+            // NODE_FLAG_NODE (0x8) is clear.  This signature is
+            // reserved for UTF-8 strings (corresponding to valid ASCII
+            // values in the first byte).
+            //
+            panic (bp);
+
+        // v-- Everything below here has NODE_FLAG_NODE set (0x8)
+
+          case 8:
+            // 0x8: unmanaged and unmarked, e.g. a series that was made
+            // with Make_Series() and hasn't been managed.  It doesn't
+            // participate in the GC.  Leave it as is.
+            //
+            // !!! Are there actually legitimate reasons to do this with
+            // arrays, where the creator knows the cells do not need
+            // GC protection?  Should finding an array in this state be
+            // considered a problem (e.g. the GC ran when you thought it
+            // couldn't run yet, hence would be able to free the array?)
+            //
+            ++live;
+            break;
+
+          case 9:
+            // 0x8 + 0x1: marked but not managed, this can't happen,
+            // because the marking itself asserts nodes are managed.
+            //
+            panic (bp);
+
+          case 10:
+            // 0x8 + 0x2: managed but didn't get marked, should be GC'd
+            //
+            // !!! It would be nice if we could have NODE_FLAG_CELL here
+            // as part of the switch, but see its definition for why it
+            // is at position 8 from left and not an earlier bit.
+            //
+            // A minor recycle didn't look at old series, so their lack
+            // of a mark means nothing.  Pairings don't have room for an
+            // OLD bit, so they are left for the next major recycle.
+            //
+            if (GC_Minor) {
+                if (
+                    (*bp & NODE_BYTEMASK_0x01_CELL)
+                    or GET_SERIES_INFO(cast(REBSER*, bp), OLD)
+                ){
+                    ++live;
+                    break;
                 }
-                else {
-                    REBSER *s = cast(REBSER*, bp);
-                    GC_Kill_Series(s);
+            }
+
+            if (*bp & NODE_BYTEMASK_0x01_CELL) {
+                assert(not (*bp & NODE_BYTEMASK_0x04_ROOT));
+                Free_Node(SER_POOL, NOD(bp));  // Free_Pairing for manuals
+            }
+            else {
+                REBSER *s = cast(REBSER*, bp);
+                if (sweep_quietly and Needs_Safe_Point_To_Kill(s)) {
+                    Defer_Kill(s);
+                    ++live;
+                    break;
                 }
-                ++count;
-                break;
+                GC_Kill_Series(s);
+            }
+            ++count;
+            break;
 
-              case 11:
-                // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
-                // Don't GC it, just clear the mark.
-                //
-                *bp &= ~NODE_BYTEMASK_0x10_MARKED;
-                break;
+          case 11:
+            // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
+            // Don't GC it, just clear the mark.  Series that survive are
+            // promoted to the old generation.
+            //
+            *bp &= ~NODE_BYTEMASK_0x10_MARKED;
+            if (not (*bp & NODE_BYTEMASK_0x01_CELL)) {
+                REBSER *s = cast(REBSER*, bp);
+                if (NOT_SERIES_INFO(s, OLD)) {
+                    SET_SERIES_INFO(s, OLD);
+                    ++GC_Stats.Promoted;
+                }
+            }
+            ++live;
+            break;
 
-            // v-- Everything below this line has the two leftmost bits set
-            // in the header.  In the *general* case this could be a valid
-            // first byte of a multi-byte sequence in UTF-8...so only the
-            // special bit pattern of the free case uses this.
+        // v-- Everything below this line has the two leftmost bits set
+        // in the header.  In the *general* case this could be a valid
+        // first byte of a multi-byte sequence in UTF-8...so only the
+        // special bit pattern of the free case uses this.
 
-              case 12:
-                // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
-                //
-                assert(*bp == FREED_SERIES_BYTE);
-                break;
+          case 12:
+            // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
+            //
+            assert(*bp == FREED_SERIES_BYTE);
+            break;
 
-              case 13:
-              case 14:
-              case 15:
-                panic (bp);  // 0x8 + 0x4 + ... reserved for UTF-8
-            }
+          case 13:
+          case 14:
+          case 15:
+            panic (bp);  // 0x8 + 0x4 + ... reserved for UTF-8
         }
     }
 
+    seg->live = live;
+    seg->freed = count;
+    return count;
+}
+
+
+//
+//  Sweep_Pairings: C
+//
+// Pairings normally live in the SER_POOL, and are swept along with series.
+//
+static REBLEN Sweep_Pairings(void)
+{
+    REBLEN count = 0;
+
     // For efficiency of memory use, REBSER is nominally defined as
     // 2*sizeof(REBVAL), and so pairs can use the same nodes.  But features
     // that might make the cells a size greater than REBSER size require
     // doing pairings in a different pool.
     //
   #ifdef UNUSUAL_REBVAL_SIZE
-    for (seg = Mem_Pools[PAR_POOL].segs; seg != NULL; seg = seg->next) {
+    REBSEG *seg = Mem_Pools[PAR_POOL].segs;
+    for (; seg != NULL; seg = seg->next) {
         REBVAL *v = cast(REBVAL*, seg + 1);
         REBLEN n = Mem_Pools[PAR_POOL].units;
         for (; n > 0; --n, v += 2) {
@@ -988,7 +1343,7 @@ static REBLEN Sweep_Series(void)
                 assert(not (v->header.bits & NODE_FLAG_ROOT));
                 if (v->header.bits & NODE_FLAG_MARKED)
                     v->header.bits &= ~NODE_FLAG_MARKED;
-                else {
+                else if (not GC_Minor) {
                     Free_Node(PAR_POOL, NOD(v));  // Free_Pairing is for manuals
                     ++count;
                 }
@@ -1001,6 +1356,25 @@ static REBLEN Sweep_Series(void)
 }
 
 
+//
+//  Sweep_Series: C
+//
+// Sweep all the segments of the SER_POOL (and pairings, if separate).
+//
+static REBLEN Sweep_Series(void)
+{
+    REBLEN count = 0;
+
+    REBSEG *seg = Mem_Pools[SER_POOL].segs;
+    for (; seg != nullptr; seg = seg->next)
+        count += Sweep_Series_Segment(seg);
+
+    count += Sweep_Pairings();
+
+    return count;
+}
+
+
 #if !defined(NDEBUG)
 
 //
@@ -1057,50 +1431,395 @@ REBLEN Fill_Sweeplist(REBSER *sweeplist)
 
 
 //
-//  Recycle_Core: C
+//  Prepare_To_Mark: C
 //
-// Recycle memory no longer needed.  If sweeplist is not NULL, then it needs
-// to be a series whose width is sizeof(REBSER*), and it will be filled with
-// the list of series that *would* be recycled.
+// Bookkeeping done by every recycle before the roots are marked.
 //
-REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
+static void Prepare_To_Mark(void)
 {
-    // Ordinarily, it should not be possible to spawn a recycle during a
-    // recycle.  But when debug code is added into the recycling code, it
-    // could cause a recursion.  Be tolerant of such recursions to make that
-    // debugging easier...but make a note that it's not ordinarily legal.
-    //
-  #if !defined(NDEBUG)
-    if (GC_Recycling) {
-        printf("Recycle re-entry; should only happen in debug scenarios.\n");
-        SET_SIGNAL(SIG_RECYCLE);
-        return 0;
-    }
-  #endif
-
-    // It is currently assumed that no recycle will happen while in a thrown
-    // state.  Debug calls that do evaluation (or even Recycle() directly)
-    // between the time a function has been called and the throw is handled
-    // can cause problems with this.
+    // WARNING: This terminates an existing open block.  This could be a
+    // problem if code is building a new value at the tail, but has not yet
+    // updated the TAIL marker.
     //
-    assert(IS_END(&TG_Thrown_Arg));
-  #if !defined(NDEBUG)
-    assert(IS_END(&TG_Thrown_Label_Debug));
-  #endif
+    TERM_ARRAY_LEN(BUF_COLLECT, ARR_LEN(BUF_COLLECT));
 
-    // If disabled by RECYCLE/OFF, exit now but set the pending flag.  (If
-    // shutdown, ignore so recycling runs and can be checked for balance.)
+    // The TG_Reuse list consists of entries which could grow to arbitrary
+    // length, and which aren't being tracked anywhere.  Cull them during GC
+    // in case the stack at one point got very deep and isn't going to use
+    // them again, and the memory needs reclaiming.
     //
-    if (not shutdown and GC_Disabled) {
-        SET_SIGNAL(SIG_RECYCLE);
-        return 0;
+    while (TG_Reuse) {
+        REBARR *varlist = TG_Reuse;
+        TG_Reuse = LINK(TG_Reuse).reuse;
+        GC_Kill_Series(SER(varlist)); // no track for Free_Unmanaged_Series()
     }
+}
 
-  #if !defined(NDEBUG)
-    GC_Recycling = true;
+
+//
+//  Mark_Root_Set: C
+//
+// Mark the roots other than those found by Mark_Root_Series() (which has to
+// walk the whole series pool) and Mark_Devices_Deep().
+//
+// Mark_Symbol_Series() goes first because it doesn't queue anything, and
+// checks that nothing is queued...which won't be true during the first
+// slice of an incremental recycle, as it doesn't propagate marks.
+//
+static void Mark_Root_Set(void)
+{
+    Mark_Symbol_Series();
+    Mark_Natives();
+
+    Mark_Data_Stack();
+
+    Mark_Guarded_Nodes();
+
+    Mark_Frame_Stack_Deep();
+}
+
+
+//=//// LAZY AND INCREMENTAL SWEEPING /////////////////////////////////////=//
+//
+// Sweeping doesn't have to happen right after marking.  Marks stay valid as
+// long as nothing new gets freed without one, so the segments of SER_POOL
+// can be swept a few at a time while evaluation continues.  GC_Sweeping is
+// true while there are segments left to sweep (starting at `sweep_seg`).
+//
+// With RECYCLE/LAZY, an automatic recycle just marks, and segments are swept
+// when Make_Node() finds the free list has run dry...so the cost of sweeping
+// is paid for by allocation, and in proportion to it.  Incremental recycles
+// (RECYCLE/BUDGET, see below) sweep segments in timed slices.
+//
+// Freeing some series runs HANDLE! cleaners and Decay_Series() hooks (e.g.
+// forgetting FIND indexes, or taking a symbol out of the word table).  That
+// must never happen inside of an allocation, where the caller may hold raw
+// pointers the cleaner frees, or be halfway through updating those tables.
+// So segments swept by Make_Node() are swept "quietly": series like that
+// are left to be killed when the sweep is finished.  Finishing the sweep
+// (which also trims the pools) is only done at safe points: in RECYCLE, in
+// an incremental slice, or by Do_Signals_Throws() for SIG_LAZY_SWEEP, which
+// Make_Node() raises after sweeping.
+//
+// While a sweep is pending, Make_Node() must not hand out a node from a
+// segment the sweep hasn't reached, or it would be freed for not being
+// marked.  So the free list is set aside ("parked") when sweeping starts,
+// along with nodes freed before the sweep ends.  When a segment is swept,
+// the nodes freed from it are moved to the free list.  Others have to wait
+// until the sweep is over, when the lists are joined back up.  Series that
+// become managed while a sweep is pending are marked, so they aren't freed
+// if they happen to be in a part that hasn't been swept yet.
+//
+// Sweeping a segment records how many of its nodes are live (REBSEG.live)
+// and how many it freed.  (These counts are kept by eager sweeps too.)
+//
+
+static REBSEG *sweep_seg = nullptr;  // next segment to be swept
+static REBLEN sweep_count = 0;  // nodes freed by the pending sweep so far
+static bool sweep_minor = false;  // pending sweep is for a minor recycle
+static bool sweep_incremental = false;  // ...or for an incremental one
+static bool sweep_lazily = false;  // Recycle_Auto() wants a lazy sweep
+
+static REBNOD *parked_head = nullptr;  // free list set aside while sweeping
+static REBNOD *parked_tail = nullptr;  // nullptr if not known
+
+static REBSER *kept_nodes;  // nodes marked by Keep_Node_Through_Sweep()
+
+
+//
+//  Park_Freed_Node: C
+//
+// Free_Node() calls this instead of putting a node on the SER_POOL's free
+// list while a sweep is pending.
+//
+void Park_Freed_Node(REBNOD *node)
+{
+    assert(GC_Sweeping);
+
+    node->next_if_free = parked_head;
+    if (parked_head == nullptr)
+        parked_tail = node;
+    parked_head = node;
+
+    ++Mem_Pools[SER_POOL].free;
+}
+
+
+//
+//  Keep_Node_Through_Sweep: C
+//
+// Manage_Series() and Manage_Pairing() call this while a sweep is pending.
+// The node wasn't managed when marking finished, so it wasn't marked...and
+// the sweep would free it.
+//
+void Keep_Node_Through_Sweep(REBNOD *node)
+{
+    assert(GC_Sweeping);
+
+    node->header.bits |= NODE_FLAG_MARKED;
+
+    if (SER_FULL(kept_nodes))
+        Extend_Series(kept_nodes, 8);
+    *SER_AT(REBNOD*, kept_nodes, SER_USED(kept_nodes)) = node;
+    SET_SERIES_USED(kept_nodes, SER_USED(kept_nodes) + 1);
+}
+
+
+static void Start_Sweep(bool incremental)
+{
+    assert(not GC_Sweeping);
+
+    REBPOL *pool = &Mem_Pools[SER_POOL];
+    parked_head = pool->first;
+    parked_tail = pool->last;  // release builds only track it sometimes
+    pool->first = nullptr;
+    pool->last = nullptr;
+
+    sweep_seg = pool->segs;
+    sweep_count = 0;
+    sweep_minor = GC_Minor;
+    sweep_incremental = incremental;
+
+    GC_Sweeping = true;
+}
+
+
+// Sweep the next segment, and move the nodes that freed to the free list.
+// (Freeing a series can free nodes in other segments, e.g. bookmarks, and
+// those stay parked.)
+//
+static void Sweep_Next_Segment(void)
+{
+    REBSEG *seg = sweep_seg;
+    sweep_seg = seg->next;
+
+    bool was_minor = GC_Minor;
+    GC_Minor = sweep_minor;
+
+    REBNOD *prior_head = parked_head;
+    sweep_count += Sweep_Series_Segment(seg);
+
+    GC_Minor = was_minor;
+
+    REBPOL *pool = &Mem_Pools[SER_POOL];
+    REBYTE *lo = cast(REBYTE*, seg + 1);
+    REBYTE *hi = lo + pool->units * sizeof(REBSER);
+
+    REBNOD **link = &parked_head;
+    while (*link != prior_head) {
+        REBNOD *node = *link;
+        REBYTE *bp = cast(REBYTE*, node);
+        if (bp < lo or bp >= hi) {
+            link = &node->next_if_free;
+            continue;
+        }
+
+        *link = node->next_if_free;
+        if (node == parked_tail)
+            parked_tail = nullptr;  // not known, Finish_Sweep() will find
+
+        if (pool->first == nullptr)
+            pool->last = node;
+        node->next_if_free = pool->first;
+        pool->first = node;
+    }
+}
+
+
+// Finish_Sweep() calls this at a safe point.  A deferred symbol may have been
+// interned again since, in which case it was marked to be kept.
+//
+static void Kill_Deferred_Series(void)
+{
+    REBSER **sp = SER_HEAD(REBSER*, deferred_kills);
+    REBLEN n = SER_USED(deferred_kills);
+    for (; n > 0; --n, ++sp) {
+        if ((*sp)->header.bits & NODE_FLAG_MARKED)
+            continue;  // see Keep_Interning_If_Sweeping()
+        GC_Kill_Series(*sp);
+        ++sweep_count;
+    }
+    SET_SERIES_USED(deferred_kills, 0);
+}
+
+
+static REBLEN Finish_Sweep(void)
+{
+    assert(GC_Sweeping and sweep_seg == nullptr);
+
+    Kill_Deferred_Series();  // before the marks of kept nodes are cleared
+
+    REBNOD **np = SER_HEAD(REBNOD*, kept_nodes);
+    REBLEN n = SER_USED(kept_nodes);
+    for (; n > 0; --n, ++np) {
+        if (not IS_FREE_NODE(*np))  // pairings can be unmanaged and freed
+            (*np)->header.bits &= ~NODE_FLAG_MARKED;
+    }
+    SET_SERIES_USED(kept_nodes, 0);
+
+    GC_Sweeping = false;
+
+    if (parked_head != nullptr) {
+        if (parked_tail == nullptr) {
+            parked_tail = parked_head;
+            while (parked_tail->next_if_free != nullptr)
+                parked_tail = parked_tail->next_if_free;
+        }
+
+        REBPOL *pool = &Mem_Pools[SER_POOL];
+        parked_tail->next_if_free = pool->first;
+        if (pool->first == nullptr)
+            pool->last = parked_tail;
+        pool->first = parked_head;
+
+        parked_head = nullptr;
+        parked_tail = nullptr;
+    }
+
+  #if !defined(NDEBUG)
+    PG_Reb_Stats->Recycle_Series
+        = Mem_Pools[SER_POOL].free - PG_Reb_Stats->Recycle_Series;
+    PG_Reb_Stats->Recycle_Series_Total += PG_Reb_Stats->Recycle_Series;
+    PG_Reb_Stats->Recycle_Prior_Eval = Eval_Cycles;
   #endif
 
+    if (not sweep_minor)
+        Trim_Pools(true);  // see notes in Recycle_Core()
+
+    if (sweep_incremental) {
+        ++GC_Stats.Incremental_Recycles;
+
+      #if !defined(NDEBUG)
+        if (Reb_Opts->watch_recycle) {
+            printf(
+                "RECYCLE/BUDGET: %u nodes\n",
+                cast(unsigned int, sweep_count)
+            );
+            fflush(stdout);
+        }
+      #endif
+    }
+
+    return sweep_count;
+}
+
+
+// Sweep pending segments until they're all swept, or the deadline passes (a
+// deadline of 0 means no limit).  Returns true if the sweep was finished.
+//
+static bool Sweep_Until(clock_t deadline)
+{
+    assert(GC_Sweeping);
+
+    while (sweep_seg != nullptr) {
+        Sweep_Next_Segment();
+
+        if (deadline != 0 and clock() >= deadline)
+            break;
+    }
+    return sweep_seg == nullptr;
+}
+
+
+//
+//  Sweep_For_Node: C
+//
+// Make_Node() calls this when the SER_POOL's free list is empty and there's
+// a sweep pending.  Segments are swept quietly until one of them frees a
+// node.  The sweep isn't finished here even if that was the last segment,
+// it's left for Sweep_Lazily() at the next safe point (see notes above).
+//
+void Sweep_For_Node(void)
+{
+    assert(GC_Sweeping and not sweep_quietly);
+
+    sweep_quietly = true;
+    while (sweep_seg != nullptr and Mem_Pools[SER_POOL].first == nullptr) {
+        Sweep_Next_Segment();
+        ++GC_Stats.Lazy_Sweeps;
+    }
+    sweep_quietly = false;
+
+    SET_SIGNAL(SIG_LAZY_SWEEP);
+}
+
+
+//
+//  Sweep_Lazily: C
+//
+// Do_Signals_Throws() calls this for SIG_LAZY_SWEEP.  Segments are swept
+// until one of them frees a node, and if that was the last segment then the
+// sweep is finished.  Only call it where running HANDLE! cleaners and decay
+// hooks is safe, never from inside an allocation (see Sweep_For_Node()).
+//
+void Sweep_Lazily(void)
+{
+    assert(GC_Sweeping);
+
+    while (sweep_seg != nullptr) {
+        REBLEN prior_count = sweep_count;
+        Sweep_Next_Segment();
+        ++GC_Stats.Lazy_Sweeps;
+        if (sweep_count != prior_count)
+            break;
+    }
+
+    if (sweep_seg == nullptr)
+        Finish_Sweep();
+}
+
+
+//=//// INCREMENTAL RECYCLING /////////////////////////////////////////////=//
+//
+// With RECYCLE/BUDGET, automatic recycles are split into slices that each
+// try to finish within GC_Budget microseconds, with evaluation in between.
+// Once a cycle has started, Do_Signals_Throws() takes a slice each time it
+// runs until the cycle is done.
+//
+// The first slice queues the roots, and later slices propagate the marks.
+// While marking is in progress (GC_Marking), a series that was marked and
+// then modified is remembered by Remember_Series_Write(), and traced again.
+// When there's nothing left to trace, one atomic slice rescans the roots
+// (which may have changed, including the contents of root series marked by
+// an earlier slice) and finishes the marking.  Then slices sweep the
+// series pool, a segment at a time.
+//
+// !!! The atomic slice includes the walk of the whole series pool done by
+// Mark_Root_Series(), so its pause grows with the heap and isn't bounded by
+// the budget.  Also, series that become garbage after they were marked will
+// survive until the next cycle.
+//
+
+
+//
+//  Drain_Remembered_Series: C
+//
+// Trace again the series that were modified after being marked.  (Old series
+// remembered for the sake of minor recycles are forgotten, since this is a
+// major recycle.)
+//
+static void Drain_Remembered_Series(void)
+{
+    assert(GC_Marking);
+
+    while (SER_USED(GC_Remembered) != 0) {
+        SET_SERIES_USED(GC_Remembered, SER_USED(GC_Remembered) - 1);
+        REBSER *s = *SER_AT(REBSER*, GC_Remembered, SER_USED(GC_Remembered));
+
+        assert(GET_SERIES_INFO(s, REMEMBERED));
+        CLEAR_SERIES_INFO(s, REMEMBERED);
+
+        if (s->header.bits & NODE_FLAG_MARKED)
+            Queue_Mark_Series_Contents(s);
+    }
+}
+
+
+static void Start_Incremental_Recycle(void)
+{
+    assert(not GC_Marking and not GC_Sweeping);
     ASSERT_NO_GC_MARKS_PENDING();
+
     Reify_Any_C_Valist_Frames();
 
   #if !defined(NDEBUG)
@@ -1109,23 +1828,215 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     PG_Reb_Stats->Mark_Count = 0;
   #endif
 
-    // WARNING: This terminates an existing open block.  This could be a
-    // problem if code is building a new value at the tail, but has not yet
-    // updated the TAIL marker.
+    propagate_later = true;
+    Mark_Root_Set();
+    propagate_later = false;
+
+    GC_Marking = true;
+
+    // Allocations made while the cycle is in progress count toward the
+    // next one.
     //
-    TERM_ARRAY_LEN(BUF_COLLECT, ARR_LEN(BUF_COLLECT));
+    GC_Ballast = TG_Ballast;
+}
 
-    // The TG_Reuse list consists of entries which could grow to arbitrary
-    // length, and which aren't being tracked anywhere.  Cull them during GC
-    // in case the stack at one point got very deep and isn't going to use
-    // them again, and the memory needs reclaiming.
+
+static void Finish_Incremental_Marking(void)
+{
+    assert(GC_Marking);
+
+    Reify_Any_C_Valist_Frames();
+    Prepare_To_Mark();
+
+    Drain_Remembered_Series();
+    Propagate_All_GC_Marks();
+
+    Mark_Root_Series();
+    Mark_Root_Set();
+    Mark_Devices_Deep();
+
+  #if !defined(NDEBUG)
+    Verify_No_Missed_Barriers_Debug();
+  #endif
+
+    assert(SER_USED(GC_Remembered) == 0);  // marking doesn't write series
+    GC_Marking = false;
+
+    ASSERT_NO_GC_MARKS_PENDING();
+
+    minors_since_major = 0;
+
+    REBLEN pairings = Sweep_Pairings();
+    Start_Sweep(true);
+    sweep_count = pairings;
+}
+
+
+// Run the current phase of an incremental recycle until it is done, or the
+// deadline passes (a deadline of 0 means no limit).  Returns true if the
+// phase was finished.
+//
+static bool Recycle_Incrementally_Until(clock_t deadline)
+{
+    if (GC_Marking) {
+        Drain_Remembered_Series();
+        return Propagate_GC_Marks_Until(deadline);
+    }
+
+    return Sweep_Until(deadline);
+}
+
+
+//
+//  Finish_Pending_Recycle: C
+//
+// A recycle can't start while an incremental recycle is in progress, or a
+// sweep is pending, so the rest of that work is done all at once.
+//
+static REBLEN Finish_Pending_Recycle(void)
+{
+    if (GC_Marking) {
+        bool done = Recycle_Incrementally_Until(0);
+        assert(done);
+        UNUSED(done);
+        Finish_Incremental_Marking();
+    }
+
+    bool done = Sweep_Until(0);
+    assert(done);
+    UNUSED(done);
+    return Finish_Sweep();
+}
+
+
+//
+//  Recycle_Incremental_Step: C
+//
+// Do one slice of an incremental recycle, starting a new cycle if there isn't
+// one in progress.  Returns the number of nodes freed if this slice finished
+// the cycle, otherwise 0.
+//
+// (If a lazy sweep is pending, the slices sweep that first.)
+//
+REBLEN Recycle_Incremental_Step(void)
+{
+  #if !defined(NDEBUG)
+    if (GC_Recycling) {
+        printf("Recycle re-entry; should only happen in debug scenarios.\n");
+        return 0;
+    }
+  #endif
+
+    assert(IS_END(&TG_Thrown_Arg));
+
+    if (GC_Disabled) {
+        SET_SIGNAL(SIG_RECYCLE);
+        return 0;
+    }
+
+  #if !defined(NDEBUG)
+    GC_Recycling = true;
+  #endif
+
+    clock_t start = clock();
+
+    clock_t deadline = 0;  // a budget of 0 finishes the current phase
+    if (GC_Budget != 0) {
+        clock_t ticks = cast(clock_t, GC_Budget * CLOCKS_PER_SEC / 1000000);
+        deadline = start + (ticks < 1 ? 1 : ticks);
+    }
+
+    REBLEN count = 0;
+    if (GC_Marking) {
+        if (Recycle_Incrementally_Until(deadline))
+            Finish_Incremental_Marking();
+    }
+    else if (GC_Sweeping) {
+        if (Sweep_Until(deadline))
+            count = Finish_Sweep();
+    }
+    else
+        Start_Incremental_Recycle();
+
+    REBI64 pause = cast(REBI64, clock() - start) * 1000000 / CLOCKS_PER_SEC;
+    ++GC_Stats.Slices;
+    GC_Stats.Slice_Pause_Total += pause;
+    if (pause > GC_Stats.Slice_Pause_Max)
+        GC_Stats.Slice_Pause_Max = pause;
+
+  #if !defined(NDEBUG)
+    GC_Recycling = false;
+  #endif
+
+    return count;
+}
+
+
+//
+//  Recycle_Core: C
+//
+// Recycle memory no longer needed.  If sweeplist is not NULL, then it needs
+// to be a series whose width is sizeof(REBSER*), and it will be filled with
+// the list of series that *would* be recycled.
+//
+REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
+{
+    // Ordinarily, it should not be possible to spawn a recycle during a
+    // recycle.  But when debug code is added into the recycling code, it
+    // could cause a recursion.  Be tolerant of such recursions to make that
+    // debugging easier...but make a note that it's not ordinarily legal.
     //
-    while (TG_Reuse) {
-        REBARR *varlist = TG_Reuse;
-        TG_Reuse = LINK(TG_Reuse).reuse;
-        GC_Kill_Series(SER(varlist)); // no track for Free_Unmanaged_Series()
+  #if !defined(NDEBUG)
+    if (GC_Recycling) {
+        printf("Recycle re-entry; should only happen in debug scenarios.\n");
+        SET_SIGNAL(SIG_RECYCLE);
+        return 0;
+    }
+  #endif
+
+    // It is currently assumed that no recycle will happen while in a thrown
+    // state.  Debug calls that do evaluation (or even Recycle() directly)
+    // between the time a function has been called and the throw is handled
+    // can cause problems with this.
+    //
+    assert(IS_END(&TG_Thrown_Arg));
+  #if !defined(NDEBUG)
+    assert(IS_END(&TG_Thrown_Label_Debug));
+  #endif
+
+    // If disabled by RECYCLE/OFF, exit now but set the pending flag.  (If
+    // shutdown, ignore so recycling runs and can be checked for balance.)
+    //
+    if (not shutdown and GC_Disabled) {
+        SET_SIGNAL(SIG_RECYCLE);
+        return 0;
     }
 
+  #if !defined(NDEBUG)
+    GC_Recycling = true;
+  #endif
+
+    // An incremental recycle in progress or a pending sweep has marks and a
+    // free list that are in flux, so it has to be finished before another
+    // recycle can start.  (What it frees isn't counted, so /VERBOSE can
+    // check its sweeplist.)
+    //
+    if (GC_Marking or GC_Sweeping)
+        Finish_Pending_Recycle();
+
+    clock_t start = clock();
+
+    ASSERT_NO_GC_MARKS_PENDING();
+    Reify_Any_C_Valist_Frames();
+
+  #if !defined(NDEBUG)
+    PG_Reb_Stats->Recycle_Counter++;
+    PG_Reb_Stats->Recycle_Series = Mem_Pools[SER_POOL].free;
+    PG_Reb_Stats->Mark_Count = 0;
+  #endif
+
+    Prepare_To_Mark();
+
     // MARKING PHASE: the "root set" from which we determine the liveness
     // (or deadness) of a series.  If we are shutting down, we do not mark
     // several categories of series...but we do need to run the root marking.
@@ -1135,20 +2046,23 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     Mark_Root_Series();
 
     if (not shutdown) {
-        Mark_Natives();
-        Mark_Symbol_Series();
+        Mark_Root_Set();
 
-        Mark_Data_Stack();
-
-        Mark_Guarded_Nodes();
-
-        Mark_Frame_Stack_Deep();
+        if (GC_Minor)
+            Mark_Remembered_Series();
 
         Propagate_All_GC_Marks();
 
         Mark_Devices_Deep();
     }
 
+  #if !defined(NDEBUG)
+    if (GC_Minor)
+        Verify_No_Missed_Barriers_Debug();
+  #endif
+
+    Forget_Remembered_Series();
+
     // SWEEPING PHASE
 
     ASSERT_NO_GC_MARKS_PENDING();
@@ -1162,15 +2076,28 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
         count += Fill_Sweeplist(sweeplist);
     #endif
     }
-    else
+    else if (sweep_lazily and not shutdown) {
+        count += Sweep_Pairings();  // in their own pool if UNUSUAL_REBVAL_SIZE
+        Start_Sweep(false);  // swept at safe points, see Sweep_Lazily()
+    }
+    else {
         count += Sweep_Series();
 
+        // After a full recycle, give back memory from pools that are mostly
+        // free...such as after a spike in usage.
+        //
+        if (not GC_Minor and not shutdown)
+            Trim_Pools(true);
+    }
+
 #if !defined(NDEBUG)
-    // Compute new stats:
-    PG_Reb_Stats->Recycle_Series
-        = Mem_Pools[SER_POOL].free - PG_Reb_Stats->Recycle_Series;
-    PG_Reb_Stats->Recycle_Series_Total += PG_Reb_Stats->Recycle_Series;
-    PG_Reb_Stats->Recycle_Prior_Eval = Eval_Cycles;
+    // Compute new stats (Finish_Sweep() does this for lazy sweeps)
+    if (not GC_Sweeping) {
+        PG_Reb_Stats->Recycle_Series
+            = Mem_Pools[SER_POOL].free - PG_Reb_Stats->Recycle_Series;
+        PG_Reb_Stats->Recycle_Series_Total += PG_Reb_Stats->Recycle_Series;
+        PG_Reb_Stats->Recycle_Prior_Eval = Eval_Cycles;
+    }
 #endif
 
     // !!! This reset of the "ballast" is the original code from R3-Alpha:
@@ -1187,6 +2114,22 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     if (not shutdown)
         GC_Ballast = TG_Ballast;
 
+    REBI64 pause = cast(REBI64, clock() - start) * 1000000 / CLOCKS_PER_SEC;
+    if (GC_Minor) {
+        ++minors_since_major;
+        ++GC_Stats.Minor_Recycles;
+        GC_Stats.Minor_Pause_Total += pause;
+        if (pause > GC_Stats.Minor_Pause_Max)
+            GC_Stats.Minor_Pause_Max = pause;
+    }
+    else {
+        minors_since_major = 0;
+        ++GC_Stats.Major_Recycles;
+        GC_Stats.Major_Pause_Total += pause;
+        if (pause > GC_Stats.Major_Pause_Max)
+            GC_Stats.Major_Pause_Max = pause;
+    }
+
     ASSERT_NO_GC_MARKS_PENDING();
 
   #if !defined(NDEBUG)
@@ -1201,7 +2144,11 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     // stack, so calling into the evaluator e.g. for rebPrint() may be bad.
     //
     if (Reb_Opts->watch_recycle) {
-        printf("RECYCLE: %u nodes\n", cast(unsigned int, count));
+        printf(
+            "RECYCLE%s: %u nodes\n",
+            GC_Minor ? "/MINOR" : "",
+            cast(unsigned int, count)
+        );
         fflush(stdout);
     }
   #endif
@@ -1210,6 +2157,60 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
 }
 
 
+//
+//  Recycle_Minor: C
+//
+// Recycle only series that have been managed since the last recycle, and
+// promote the ones that survive to the old generation.
+//
+REBLEN Recycle_Minor(void)
+{
+    if (GC_Marking)  // incremental recycle must be finished as a major one
+        return Recycle_Core(false, NULL);
+
+    assert(not GC_Minor);
+    GC_Minor = true;  // old series are not traced or freed
+
+    REBLEN n = Recycle_Core(false, NULL);
+
+    GC_Minor = false;
+    return n;
+}
+
+
+//
+//  Recycle_Auto: C
+//
+// The recycle triggered by running low on GC_Ballast.  If generational mode
+// is on (RECYCLE/GENERATIONAL) then most of these are minor, but after each
+// GC_MINORS_PER_MAJOR of them there's a full recycle to free old series that
+// have died (and pairings, which minor recycles never free).
+//
+// If there's a budget (RECYCLE/BUDGET) then the full recycles are done
+// incrementally, and this just does the next slice of one in progress.  If
+// RECYCLE/LAZY is on, recycles leave the sweeping to be done when Make_Node()
+// runs out of nodes (at the next evaluator safe point, see Sweep_Lazily()).
+//
+REBLEN Recycle_Auto(void)
+{
+    if (GC_Marking or (GC_Sweeping and GC_Budget != 0))
+        return Recycle_Incremental_Step();
+
+    sweep_lazily = GC_Lazy;
+
+    REBLEN count;
+    if (GC_Generational and minors_since_major < GC_MINORS_PER_MAJOR)
+        count = Recycle_Minor();
+    else if (GC_Budget != 0)
+        count = Recycle_Incremental_Step();
+    else
+        count = Recycle();
+
+    sweep_lazily = false;
+    return count;
+}
+
+
 //
 //  Recycle: C
 //
@@ -1236,6 +2237,27 @@ REBLEN Recycle(void)
 }
 
 
+//
+//  Remember_Series: C
+//
+// Out-of-line part of Remember_Series_Write(), for when a series that is not
+// yet in the remembered set gets modified and is old (or was marked by an
+// incremental recycle in progress).
+//
+void Remember_Series(REBSER *s)
+{
+    assert(NOT_SERIES_INFO(s, REMEMBERED));
+
+    if (SER_FULL(GC_Remembered))
+        Extend_Series(GC_Remembered, 8);
+
+    *SER_AT(REBSER*, GC_Remembered, SER_USED(GC_Remembered)) = s;
+    SET_SERIES_USED(GC_Remembered, SER_USED(GC_Remembered) + 1);
+
+    SET_SERIES_INFO(s, REMEMBERED);
+}
+
+
 //
 //  Push_Guard_Node: C
 //
@@ -1303,6 +2325,26 @@ void Startup_GC(void)
     //
     GC_Mark_Stack = Make_Series(100, sizeof(REBARR*));
     TERM_SEQUENCE(GC_Mark_Stack);
+
+    // Old series that have been modified since the last recycle, so they
+    // need to be traced by a minor recycle.
+    //
+    GC_Remembered = Make_Series(15, sizeof(REBSER*));
+
+    // Nodes that became managed while a sweep was pending.
+    //
+    kept_nodes = Make_Series(15, sizeof(REBNOD*));
+
+    // Dead series a quiet sweep couldn't kill, see Sweep_For_Node().
+    //
+    deferred_kills = Make_Series(15, sizeof(REBSER*));
+
+    GC_Generational = false;
+    GC_Budget = 0;
+    GC_Lazy = false;
+    GC_Marking = false;
+    GC_Sweeping = false;
+    memset(&GC_Stats, 0, sizeof(GC_Stats));
 }
 
 
@@ -1313,6 +2355,9 @@ void Shutdown_GC(void)
 {
     Free_Unmanaged_Series(GC_Guarded);
     Free_Unmanaged_Series(GC_Mark_Stack);
+    Free_Unmanaged_Series(GC_Remembered);
+    Free_Unmanaged_Series(kept_nodes);
+    Free_Unmanaged_Series(deferred_kills);
 }
 
 
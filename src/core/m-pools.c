@@ -63,6 +63,77 @@
 #include "sys-int-funcs.h"
 
 
+//=//// SIZE CLASS CACHES ///////////////////////////////////////////////=//
+//
+// Series data too big for the pools came straight from malloc(), so growing
+// a large buffer (as MOLD and APPEND do) or churning through copies of one
+// made a round trip through malloc() and free() each time.  Instead, sizes
+// between MEM_CACHE_MIN and MEM_CACHE_MAX are rounded up to a size class,
+// and freed blocks are held in a list for that class to be reused.
+//
+// Each class starts out willing to hold MEM_CACHE_LIMIT blocks.  If a block
+// had to be given back with free() because the cache was full, and then the
+// cache runs dry, the limit is doubled.  Trim_Mem_Caches() halves it again
+// when recycles find the demand has gone away.
+//
+// The interpreter is single threaded, so there is just one set of caches.
+//
+
+typedef struct {
+    void *first;  // free blocks, linked through their first pointer
+    REBLEN count;  // number of blocks in the list
+    REBLEN limit;  // most blocks the list will hold
+    REBLEN dropped;  // blocks given to free() since the list last ran dry
+} REBMCC;
+
+static REBMCC Mem_Caches[MEM_CACHE_CLASSES];
+
+// Rounding up to a class happens whether or not caching is on, so a block's
+// true size is always known from the size passed to Free_Mem().  Caching is
+// only done between Startup_Pools() and Shutdown_Pools().
+//
+static bool Mem_Caching = false;
+
+
+inline static bool Is_Mem_Cache_Size(size_t size) {
+  #ifdef DEBUG_ENABLE_ALWAYS_MALLOC
+    if (PG_Always_Malloc)
+        return false;  // let Valgrind and ASAN see each malloc() and free()
+  #endif
+    return size > MEM_CACHE_MIN and size <= MEM_CACHE_MAX;
+}
+
+inline static REBLEN Mem_Cache_Class(size_t size) {
+    REBLEN doublings = 0;
+    while (size > cast(size_t, MEM_CACHE_MIN) << (doublings + 1))
+        ++doublings;
+
+    size_t base = cast(size_t, MEM_CACHE_MIN) << doublings;
+    size_t step = base / MEM_CACHE_STEPS;
+    return doublings * MEM_CACHE_STEPS + (size - base - 1) / step;
+}
+
+inline static size_t Mem_Cache_Class_Size(REBLEN n) {
+    size_t base = cast(size_t, MEM_CACHE_MIN) << (n / MEM_CACHE_STEPS);
+    return base / MEM_CACHE_STEPS * (MEM_CACHE_STEPS + n % MEM_CACHE_STEPS + 1);
+}
+
+
+//
+//  Mem_Cache_Size: C
+//
+// Size of the block Alloc_Mem() will really get for a request of `size`.
+// Callers that can use extra capacity, like series data, may ask for this
+// much up front instead of wasting it.
+//
+size_t Mem_Cache_Size(size_t size)
+{
+    if (not Is_Mem_Cache_Size(size))
+        return size;
+    return Mem_Cache_Class_Size(Mem_Cache_Class(size));
+}
+
+
 //
 //  Alloc_Mem: C
 //
@@ -87,7 +158,8 @@
 //
 // Finer-grained allocations are done with memory pooling.  But the blocks of
 // memory used by the pools are still acquired using ALLOC_N and FREE_N, which
-// are interfaces to this routine.
+// are interfaces to this routine.  Allocations too large for the pools may
+// be served from the size class caches (see Mem_Cache_Size()).
 //
 void *Alloc_Mem(size_t size)
 {
@@ -96,22 +168,61 @@ void *Alloc_Mem(size_t size)
     PG_Mem_Usage += size;
     if (PG_Mem_Limit != 0 and PG_Mem_Usage > PG_Mem_Limit)
         Check_Security_Placeholder(Canon(SYM_MEMORY), SYM_EXEC, 0);
+    if (cast(REBI64, PG_Mem_Usage) > PG_Mem_Stats.Peak_Usage)
+        PG_Mem_Stats.Peak_Usage = PG_Mem_Usage;
+
+    size_t alloc_size = size;
+    void *p_extra = nullptr;
+
+    if (Is_Mem_Cache_Size(size)) {
+        REBLEN n = Mem_Cache_Class(size);
+        alloc_size = Mem_Cache_Class_Size(n);
+
+        REBMCC *cache = &Mem_Caches[n];
+        if (cache->first) {
+            p_extra = cache->first;
+            cache->first = *cast(void**, p_extra);
+            --cache->count;
+            PG_Mem_Stats.Cached_Bytes -= alloc_size;
+            ++PG_Mem_Stats.Cache_Hits;
+        }
+        else if (cache->dropped != 0) {
+            //
+            // A block of this size was given back to free() and now another
+            // is wanted, so the cache wasn't big enough for the demand.
+            //
+            if (
+                cache->limit * alloc_size < MEM_CACHE_BYTES
+                and cache->limit != 0
+            ){
+                cache->limit *= 2;
+            }
+            cache->dropped = 0;
+        }
+    }
 
     // malloc() internally remembers the size of the allocation, and is hence
     // "overkill" for this operation.  Yet the current implementations on all
     // C platforms use malloc() and free() anyway.
 
   #ifdef NDEBUG
-    void *p = malloc(size);
+    void *p = p_extra;
+    if (not p) {
+        p = malloc(alloc_size);
+        ++PG_Mem_Stats.Mallocs;
+    }
   #else
     // Cache size at the head of the allocation in debug builds for checking.
     // Also catches free() use with Alloc_Mem() instead of Free_Mem().
     //
     // Use a 64-bit quantity to preserve DEBUG_MEMORY_ALIGN invariant.
 
-    void *p_extra = malloc(size + ALIGN_SIZE);
-    if (not p_extra)
-        return nullptr;
+    if (not p_extra) {
+        p_extra = malloc(alloc_size + ALIGN_SIZE);
+        ++PG_Mem_Stats.Mallocs;
+        if (not p_extra)
+            return nullptr;
+    }
     *cast(REBI64*, p_extra) = size;
     void *p = cast(char*, p_extra) + ALIGN_SIZE;
   #endif
@@ -139,18 +250,84 @@ void *Alloc_Mem(size_t size)
 // deciding when it is necessary to run a garbage collection, or when to
 // impose a quota.
 //
+// Blocks in the range of the size class caches may be kept for reuse by
+// Alloc_Mem() instead of being freed.  They don't count in PG_Mem_Usage.
+//
 void Free_Mem(void *mem, size_t size)
 {
   #ifdef NDEBUG
-    free(mem);
+    void *ptr = mem;
   #else
     assert(mem);
     char *ptr = cast(char *, mem) - sizeof(REBI64);
     assert(*cast(REBI64*, ptr) == cast(REBI64, size));
-    free(ptr);
   #endif
 
     PG_Mem_Usage -= size;
+
+    if (Is_Mem_Cache_Size(size) and Mem_Caching) {
+        REBLEN n = Mem_Cache_Class(size);
+        size_t alloc_size = Mem_Cache_Class_Size(n);
+
+        REBMCC *cache = &Mem_Caches[n];
+        if (
+            cache->count < cache->limit
+            and PG_Mem_Stats.Cached_Bytes + alloc_size <= MEM_CACHE_TOTAL
+        ){
+            *cast(void**, ptr) = cache->first;
+            cache->first = ptr;
+            ++cache->count;
+            PG_Mem_Stats.Cached_Bytes += alloc_size;
+            ++PG_Mem_Stats.Cache_Returns;
+            return;
+        }
+        ++cache->dropped;
+    }
+
+    free(ptr);
+    ++PG_Mem_Stats.Frees;
+}
+
+
+//
+//  Trim_Mem_Caches: C
+//
+// Give the blocks held by the size class caches back with free(), returning
+// how many bytes were released.  If `decay` then each class keeps half of
+// its blocks, and halves how many it is willing to hold...so a demand that
+// has gone away stops tying up memory after a few recycles.
+//
+REBSIZ Trim_Mem_Caches(bool decay)
+{
+    REBSIZ released = 0;
+
+    REBLEN n;
+    for (n = 0; n != MEM_CACHE_CLASSES; ++n) {
+        REBMCC *cache = &Mem_Caches[n];
+        size_t alloc_size = Mem_Cache_Class_Size(n);
+
+        REBLEN keep = 0;
+        if (decay) {
+            if (cache->limit > MEM_CACHE_LIMIT)
+                cache->limit /= 2;
+            keep = cache->count / 2;
+        }
+        else
+            cache->limit = MEM_CACHE_LIMIT;
+
+        while (cache->count > keep) {
+            void *ptr = cache->first;
+            cache->first = *cast(void**, ptr);
+            --cache->count;
+            free(ptr);
+            ++PG_Mem_Stats.Frees;
+            PG_Mem_Stats.Cached_Bytes -= alloc_size;
+            released += alloc_size;
+        }
+        cache->dropped = 0;
+    }
+
+    return released;
 }
 
 
@@ -300,6 +477,14 @@ void Startup_Pools(REBINT scale)
     Prior_Expand = ALLOC_N(REBSER*, MAX_EXPAND_LIST);
     CLEAR(Prior_Expand, sizeof(REBSER*) * MAX_EXPAND_LIST);
     Prior_Expand[0] = (REBSER*)1;
+
+    for (n = 0; n < MEM_CACHE_CLASSES; n++) {
+        Mem_Caches[n].first = nullptr;
+        Mem_Caches[n].count = 0;
+        Mem_Caches[n].limit = MEM_CACHE_LIMIT;
+        Mem_Caches[n].dropped = 0;
+    }
+    Mem_Caching = true;
 }
 
 
@@ -357,6 +542,11 @@ void Shutdown_Pools(void)
     FREE(REB_STATS, PG_Reb_Stats);
   #endif
 
+    // Anything freed from here on goes straight to free()
+    //
+    Trim_Mem_Caches(false);
+    Mem_Caching = false;
+
   #if !defined(NDEBUG)
     if (PG_Mem_Usage != 0) {
         //
@@ -408,6 +598,8 @@ void Fill_Pool(REBPOL *pool)
     }
 
     seg->size = mem_size;
+    seg->live = 0;
+    seg->freed = 0;
     seg->next = pool->segs;
     pool->segs = seg;
     pool->has += units;
@@ -446,6 +638,235 @@ void Fill_Pool(REBPOL *pool)
 }
 
 
+//
+//  Compare_Segment_Addresses: C
+//
+static int Compare_Segment_Addresses(void *thunk, const void *a, const void *b)
+{
+    UNUSED(thunk);
+    uintptr_t seg_a = cast(uintptr_t, *cast(REBSEG* const*, a));
+    uintptr_t seg_b = cast(uintptr_t, *cast(REBSEG* const*, b));
+    if (seg_a < seg_b)
+        return -1;
+    return seg_a > seg_b ? 1 : 0;
+}
+
+
+// Index of the segment containing `node`, in an array of segments sorted by
+// address (each segment's nodes come right after its REBSEG).
+//
+static REBLEN Find_Segment_Index(REBSEG **segs, REBLEN num_segs, void *node)
+{
+    REBLEN lo = 0;
+    REBLEN hi = num_segs;
+    while (hi - lo > 1) {
+        REBLEN mid = lo + (hi - lo) / 2;
+        if (cast(uintptr_t, node) < cast(uintptr_t, segs[mid]))
+            hi = mid;
+        else
+            lo = mid;
+    }
+    assert(
+        cast(uintptr_t, node) > cast(uintptr_t, segs[lo])
+        and cast(uintptr_t, node)
+            < cast(uintptr_t, segs[lo]) + cast(uintptr_t, segs[lo]->size)
+    );
+    return lo;
+}
+
+
+// Make an array of a pool's segments sorted by address, and a parallel array
+// with the number of free nodes in each.  This walks the free list, so it
+// works for any pool--not just SER_POOL, where the GC keeps live counts.
+//
+// The caller must free both arrays with FREE_N(), using `*num_segs_out`.
+//
+static REBLEN *Count_Free_Nodes_By_Segment(
+    REBSEG ***segs_out,
+    REBLEN *num_segs_out,
+    REBPOL *pool
+){
+    REBLEN num_segs = 0;
+    REBSEG *seg;
+    for (seg = pool->segs; seg != nullptr; seg = seg->next)
+        ++num_segs;
+
+    REBSEG **segs = ALLOC_N(REBSEG*, num_segs + 1);  // +1, 0 not legal
+    REBLEN *frees = ALLOC_N_ZEROFILL(REBLEN, num_segs + 1);
+
+    REBLEN i = 0;
+    for (seg = pool->segs; seg != nullptr; seg = seg->next)
+        segs[i++] = seg;
+    reb_qsort_r(
+        segs, num_segs, sizeof(REBSEG*), nullptr, &Compare_Segment_Addresses
+    );
+
+    REBNOD *node = pool->first;
+    for (; node != nullptr; node = node->next_if_free)
+        ++frees[Find_Segment_Index(segs, num_segs, node)];
+
+    *segs_out = segs;
+    *num_segs_out = num_segs;
+    return frees;
+}
+
+
+//
+//  Trim_Pool: C
+//
+// Give back the segments of a pool that have no nodes in use to the system
+// allocator, keeping up to `reserve` of them to avoid thrashing if they are
+// needed again soon.  Returns the number of bytes released.
+//
+// The nodes of released segments are removed from the free list.  This has
+// to walk the free list, so it costs time proportional to the free nodes.
+//
+// (Segments are allocated with Alloc_Mem(), and the large ones will usually
+// have been mmap()'d by the C library, so freeing them really does give the
+// memory back to the OS.)
+//
+REBSIZ Trim_Pool(REBLEN pool_id, REBLEN reserve)
+{
+    REBPOL *pool = &Mem_Pools[pool_id];
+    assert(not (pool_id == SER_POOL and GC_Sweeping));  // free list parked
+
+    if (pool->free < pool->units * (reserve + 1))
+        return 0;  // can't have enough wholly free segments to release any
+
+    REBSEG **segs;
+    REBLEN num_segs;
+    REBLEN *frees = Count_Free_Nodes_By_Segment(&segs, &num_segs, pool);
+
+    // Segments to release are flagged by leaving their free count as the
+    // number of units.  Reserved segments get their count zeroed.
+    //
+    REBLEN releasing = 0;
+    REBLEN i;
+    for (i = 0; i < num_segs; ++i) {
+        if (frees[i] != pool->units)
+            continue;
+        if (reserve > 0) {
+            --reserve;
+            frees[i] = 0;
+        }
+        else
+            ++releasing;
+    }
+
+    REBSIZ released = 0;
+
+    if (releasing != 0) {
+        REBNOD **link = &pool->first;
+        REBNOD *last = nullptr;
+        while (*link != nullptr) {
+            REBNOD *node = *link;
+            i = Find_Segment_Index(segs, num_segs, node);
+            if (frees[i] == pool->units)
+                *link = node->next_if_free;
+            else {
+                last = node;
+                link = &node->next_if_free;
+            }
+        }
+        pool->last = last;
+
+        REBSEG **seg_link = &pool->segs;
+        while (*seg_link != nullptr) {
+            REBSEG *seg = *seg_link;
+            i = Find_Segment_Index(segs, num_segs, seg + 1);
+            if (frees[i] != pool->units) {
+                seg_link = &seg->next;
+                continue;
+            }
+
+            *seg_link = seg->next;
+
+            pool->has -= pool->units;
+            pool->free -= pool->units;
+            released += seg->size;
+            FREE_N(char, seg->size, cast(char*, seg));
+        }
+    }
+
+    FREE_N(REBSEG*, num_segs + 1, segs);
+    FREE_N(REBLEN, num_segs + 1, frees);
+
+    return released;
+}
+
+
+//
+//  Trim_Pools: C
+//
+// Trim all the pools, see Trim_Pool().  If `spikes_only`, then a pool is
+// only trimmed if more than half of it is free (e.g. after a spike in usage
+// that is over) and one empty segment is kept in reserve.  The size class
+// caches are trimmed too, see Trim_Mem_Caches().
+//
+REBSIZ Trim_Pools(bool spikes_only)
+{
+    REBSIZ released = 0;
+
+    REBLEN n;
+    for (n = 0; n != SYSTEM_POOL; ++n) {
+        if (n == SER_POOL and GC_Sweeping)
+            continue;  // free list is parked, see Sweep_Lazily()
+
+        REBPOL *pool = &Mem_Pools[n];
+        if (spikes_only) {
+            if (pool->free <= pool->has / 2)
+                continue;
+            released += Trim_Pool(n, 1);
+        }
+        else
+            released += Trim_Pool(n, 0);
+    }
+
+    released += Trim_Mem_Caches(spikes_only);
+
+    GC_Stats.Trimmed_Bytes += released;
+    return released;
+}
+
+
+//
+//  Pool_Occupancy_Histogram: C
+//
+// Fill in `buckets` with how many segments of a pool are in use to what
+// degree.  buckets[0] counts wholly free segments, and then buckets[1] to
+// buckets[10] count those which are up to 10%, 20%... 100% in use.  Returns
+// the number of segments.
+//
+// (Nodes of SER_POOL that are set aside during a pending sweep are counted
+// as being in use.)
+//
+REBLEN Pool_Occupancy_Histogram(REBLEN pool_id, REBLEN *buckets)
+{
+    REBPOL *pool = &Mem_Pools[pool_id];
+
+    REBSEG **segs;
+    REBLEN num_segs;
+    REBLEN *frees = Count_Free_Nodes_By_Segment(&segs, &num_segs, pool);
+
+    REBLEN i;
+    for (i = 0; i <= 10; ++i)
+        buckets[i] = 0;
+
+    for (i = 0; i < num_segs; ++i) {
+        REBLEN used = pool->units - frees[i];
+        if (used == 0)
+            ++buckets[0];
+        else
+            ++buckets[1 + (used * 10 - 1) / pool->units];
+    }
+
+    FREE_N(REBSEG*, num_segs + 1, segs);
+    FREE_N(REBLEN, num_segs + 1, frees);
+
+    return num_segs;
+}
+
+
 #if !defined(NDEBUG)
 
 //
@@ -560,6 +981,9 @@ REBVAL *Alloc_Pairing(void) {
 //
 void Manage_Pairing(REBVAL *paired) {
     SET_CELL_FLAG(paired, MANAGED);
+
+    if (GC_Sweeping)  // see notes in Manage_Series()
+        Keep_Node_Through_Sweep(NOD(paired));
 }
 
 
@@ -692,6 +1116,8 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
     if (delta == 0)
         return;
 
+    Forget_Find_Index_If_Any(s);  // positions are shifting
+
     REBLEN used_old = SER_USED(s);
 
     REBYTE wide = SER_WIDE(s);
@@ -1062,7 +1488,44 @@ void Decay_Series(REBSER *s)
         if (Prior_Expand[n] == s) Prior_Expand[n] = 0;
     }
 
-    if (IS_SER_DYNAMIC(s)) {
+    // A new context could be made at this address, so forget any binding
+    // override decisions about it (see Get_Overriding_Context())
+    //
+    if (IS_SER_ARRAY(s) and GET_ARRAY_FLAG(s, IS_VARLIST))
+        ++TG_Binding_Epoch;
+
+    // Same for compiled PARSE rules (see %u-parse.c)
+    //
+    if (
+        IS_SER_ARRAY(s)
+        and GET_ARRAY_FLAG(s, PARSE_COMPILED)
+        and NOT_ARRAY_FLAG(s, IS_PARAMLIST)
+    ){
+        Forget_Parse_Programs(ARR(s));
+    }
+
+    // ...and FIND indexes (see %t-block.c)
+    //
+    Forget_Find_Index_If_Any(s);
+
+    if (IS_SER_DYNAMIC(s) and Is_Varlist_In_Arena(s)) {
+        //
+        // A frame's varlist being freed, as by Abort_Frame(), whose cells go
+        // back to the frame arena (a varlist from TG_Reuse may have none).
+        // The archetype is kept as with other varlists, see below.
+        //
+        RELVAL *cells = cast(RELVAL*, s->content.dynamic.data);
+        if (cells) {
+            memcpy(  // https://stackoverflow.com/q/57721104/
+                cast(char*, &s->content.fixed),
+                cast(char*, cells),
+                sizeof(REBVAL)
+            );
+            Free_Arena_Cells(cells);  // content.dynamic is overwritten now
+        }
+        mutable_LEN_BYTE_OR_255(s) = 1;
+    }
+    else if (IS_SER_DYNAMIC(s)) {
         REBYTE wide = SER_WIDE(s);
         REBLEN bias = SER_BIAS(s);
         REBLEN total = (bias + SER_REST(s)) * wide;
@@ -1290,6 +1753,9 @@ REBLEN Check_Memory_Debug(void)
             if (not IS_SER_DYNAMIC(s))
                 continue; // data lives in the series node itself
 
+            if (Is_Varlist_In_Arena(s))
+                continue; // data lives in the frame arena (or TG_Reuse)
+
             if (SER_REST(s) == 0)
                 panic (s); // zero size allocations not legal
 
@@ -204,6 +204,8 @@ void Remove_Series_Units(REBSER *s, REBSIZ offset, REBINT quantity)
     if (quantity == 0)
         return;
 
+    Forget_Find_Index_If_Any(s);  // positions are shifting
+
     bool is_dynamic = IS_SER_DYNAMIC(s);
     REBLEN used_old = SER_USED(s);
 
@@ -304,9 +306,16 @@ void Remove_Series_Len(REBSER *s, REBLEN index, REBINT len)
 
         assert(len <= len_old);
 
-        Remove_Series_Units(s, cp - STR_HEAD(str), ep - cp);
-        Free_Bookmarks_Maybe_Null(str);
-        SET_STR_LEN_SIZE(str, len_old - len, size_old - (ep - cp));
+        REBSIZ offset = cp - STR_HEAD(str);
+        REBSIZ size = ep - cp;
+
+        Remove_Series_Units(s, offset, size);
+        SET_STR_LEN_SIZE(str, len_old - len, size_old - size);
+
+        if (STR_LEN(str) < sizeof(REBVAL))  // not kept if small
+            Free_Bookmarks_Maybe_Null(str);
+        else
+            Update_Bookmarks_For_Modify(str, index, offset);
     }
     else
         Remove_Series_Units(s, index, len);
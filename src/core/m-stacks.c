@@ -71,6 +71,25 @@ void Shutdown_Data_Stack(void)
 }
 
 
+static struct Reb_Arena_Chunk *Make_Arena_Chunk(
+    struct Reb_Arena_Chunk *prev,
+    size_t size
+){
+    struct Reb_Arena_Chunk *chunk = cast(
+        struct Reb_Arena_Chunk*,
+        ALLOC_N(char, size)
+    );
+    if (not chunk)
+        fail (Error_No_Memory(size));
+
+    chunk->prev = prev;
+    chunk->next = nullptr;
+    chunk->limit = cast(char*, chunk) + size;
+    chunk->size = size;
+    return chunk;
+}
+
+
 //
 //  Startup_Frame_Stack: C
 //
@@ -93,6 +112,10 @@ void Startup_Frame_Stack(void)
     TG_Frame_Feed_End.specifier = SPECIFIED;
     TRASH_POINTER_IF_DEBUG(TG_Frame_Feed_End.pending);
 
+    TG_Arena_Chunk = Make_Arena_Chunk(nullptr, FRAME_ARENA_CHUNK_SIZE);
+    TG_Arena_Top = cast(char*, TG_Arena_Chunk) + ARENA_CHUNK_HEADER;
+    TG_Arena_Last = nullptr;
+
     REBFRM *f = ALLOC(REBFRM);  // can't use DECLARE_FRAME(), must be dynamic
     Prep_Frame_Core(f, &TG_Frame_Feed_End, EVAL_MASK_DEFAULT);
 
@@ -171,6 +194,18 @@ void Shutdown_Frame_Stack(void)
     assert(not FS_TOP);
     FREE(REBFRM, f);
 
+    assert(not TG_Arena_Last);  // all varlists' cells should be given back
+    struct Reb_Arena_Chunk *chunk = TG_Arena_Chunk;
+    while (chunk->prev)
+        chunk = chunk->prev;
+    while (chunk) {
+        struct Reb_Arena_Chunk *next = chunk->next;
+        FREE_N(char, chunk->size, cast(char*, chunk));
+        chunk = next;
+    }
+    TG_Arena_Chunk = nullptr;
+    TG_Arena_Top = nullptr;
+
     TG_Top_Frame = nullptr;
     TG_Bottom_Frame = nullptr;
 
@@ -178,6 +213,91 @@ void Shutdown_Frame_Stack(void)
 }
 
 
+//
+//  Expand_Arena: C
+//
+// Called by Alloc_Arena_Cells() when there isn't `size` bytes left in the
+// current chunk of the frame arena.  Moves on to the next chunk, which may
+// be one that was emptied earlier, or else a new one.  (What's left at the
+// end of the current chunk goes unused until the arena is popped back.)
+//
+void Expand_Arena(size_t size)
+{
+    size_t needed = ARENA_CHUNK_HEADER + size;
+
+    struct Reb_Arena_Chunk *next = TG_Arena_Chunk->next;
+    if (next and next->size < needed) {  // too small, give back spare chunks
+        while (next) {
+            struct Reb_Arena_Chunk *after = next->next;
+            FREE_N(char, next->size, cast(char*, next));
+            next = after;
+        }
+        TG_Arena_Chunk->next = nullptr;
+    }
+
+    if (not next) {
+        next = Make_Arena_Chunk(
+            TG_Arena_Chunk,
+            needed > FRAME_ARENA_CHUNK_SIZE ? needed : FRAME_ARENA_CHUNK_SIZE
+        );
+        TG_Arena_Chunk->next = next;
+    }
+
+    TG_Arena_Chunk = next;
+    TG_Arena_Top = cast(char*, next) + ARENA_CHUNK_HEADER;
+}
+
+
+//
+//  Reify_Varlist_In_Arena: C
+//
+// Move the cells of a varlist out of the frame arena into an ordinary series
+// allocation.  This is done when references to the varlist will outlive the
+// action it was made for.
+//
+void Reify_Varlist_In_Arena(REBARR *varlist)
+{
+    REBSER *s = SER(varlist);
+    assert(GET_SERIES_FLAG(s, VARLIST_IN_ARENA));
+
+    RELVAL *cells = cast(RELVAL*, s->content.dynamic.data);
+    REBLEN rest = s->content.dynamic.rest;
+    REBLEN used = s->content.dynamic.used;
+
+    // This may be called during the unwinding of a fail(), so it panics
+    // instead of failing if memory is short.
+    //
+    CLEAR_SERIES_FLAG(s, VARLIST_IN_ARENA);
+    if (not Did_Series_Data_Alloc(s, rest))
+        panic ("Out of memory moving a varlist out of the frame arena");
+
+    memcpy(s->content.dynamic.data, cast(char*, cells), rest * sizeof(RELVAL));
+    s->content.dynamic.used = used;
+
+    // The allocation may be bigger than the arena's was.  The last cell in
+    // an allocation must be an end.
+    //
+    REBLEN new_rest = s->content.dynamic.rest;
+    if (new_rest > rest) {
+        RELVAL *ultimate = ARR_AT(varlist, new_rest - 1);
+        ultimate->header = Endlike_Header(0); // unreadable
+        TRACK_CELL_IF_DEBUG(ultimate, __FILE__, __LINE__);
+
+      #if !defined(NDEBUG)
+        RELVAL *prep = ultimate - 1;
+        for (; prep > ARR_AT(varlist, rest - 1); --prep) {
+            prep->header.bits =
+                FLAG_KIND_BYTE(REB_T_TRASH)
+                | FLAG_MIRROR_BYTE(REB_T_TRASH); // unreadable
+            TRACK_CELL_IF_DEBUG(prep, __FILE__, __LINE__);
+        }
+      #endif
+    }
+
+    Free_Arena_Cells(cells);
+}
+
+
 //
 //  Get_Context_From_Stack: C
 //
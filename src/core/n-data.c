@@ -207,6 +207,7 @@ REBNATIVE(bind)
     }
     else {
         at = VAL_ARRAY_AT(v); // only affects binding from current index
+        Remember_Series_Write(SER(VAL_ARRAY(v)));  // bindings will change
         Move_Value(D_OUT, v);
     }
 
@@ -287,6 +288,7 @@ REBNATIVE(in)
 
     // Special form: IN object block
     if (IS_BLOCK(word) or IS_GROUP(word)) {
+        Remember_Series_Write(SER(VAL_ARRAY(word)));  // bindings will change
         Bind_Values_Deep(VAL_ARRAY_HEAD(word), context);
         Quotify(word, num_quotes);
         RETURN (word);
@@ -680,6 +680,12 @@ REBNATIVE(hijack)
     REBARR *hijacker_paramlist = ACT_PARAMLIST(hijacker);
     REBARR *hijacker_details = ACT_DETAILS(hijacker);
 
+    // The victim may be old and the hijacker young, so the victim's arrays
+    // must be remembered for minor recycles to see what gets written here.
+    //
+    Remember_Series_Write(SER(victim_paramlist));
+    Remember_Series_Write(SER(victim_details));
+
     if (
         ACT_UNDERLYING(hijacker) == ACT_UNDERLYING(victim)
         and (ACT_NUM_PARAMS(hijacker) == ACT_NUM_PARAMS(victim))
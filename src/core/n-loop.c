@@ -406,6 +406,11 @@ static REB_R Loop_Each_Core(struct Loop_Each_State *les) {
         //
         // ANY-CONTEXT! and MAP! allow one var (keys) or two vars (keys/vals)
         //
+        // The variables are written directly, so the write barrier has to be
+        // told (the context is old if a minor recycle ran in the body).
+        //
+        Remember_Series_Write(SER(CTX_VARLIST(les->pseudo_vars_ctx)));
+
         REBVAL *pseudo_var = CTX_VAR(les->pseudo_vars_ctx, 1);
         for (; NOT_END(pseudo_var); ++pseudo_var) {
             REBVAL *var = Real_Var_From_Pseudo(pseudo_var);
@@ -1129,8 +1134,11 @@ static inline REBLEN Finalize_Remove_Each(struct Remove_Each_State *res)
         }
 
         // If we get here, we're either at the end, or all the cells from here
-        // on are going to be moving to somewhere besides the original spot
+        // on are going to be moving to somewhere besides the original spot.
+        // A FIND in the body could have indexed them where they were.
         //
+        Forget_Find_Index_If_Any(SER(VAL_ARRAY(res->data)));
+
         for (; NOT_END(dest); ++dest, ++src) {
             while (NOT_END(src) and GET_CELL_FLAG(src, MARKED_REMOVE)) {
                 ++src;
@@ -1236,6 +1244,8 @@ static REB_R Remove_Each_Core(struct Remove_Each_State *res)
     while (index < len) {
         assert(res->start == index);
 
+        Remember_Series_Write(SER(CTX_VARLIST(res->context)));  // vars set
+
         REBVAL *var = CTX_VAR(res->context, 1);  // not movable, see #2274
         for (; NOT_END(var); ++var) {
             if (index == len) {
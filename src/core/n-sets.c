@@ -25,21 +25,137 @@
 #include "sys-core.h"
 
 
+// Set operations on arrays find records (by their first value) through two
+// hashlists: one for the series being checked against, and one for the
+// result being built so that it stays unique.  Rather than allocate those
+// and a result buffer on every call, they are kept between calls much like
+// the mold buffer.  They are made at startup, which puts them at the bottom
+// of GC_Manuals--so no failure's cleanup will ever free them out from under
+// these globals.  Nothing in a set operation can evaluate, so there is no
+// chance of reentrancy.
+//
+// Inputs with fewer records than this are not hashed at all, and records
+// are found with a linear scan.
+//
+#define SET_HASH_MIN 16
+
+
+//
+//  Startup_Set_Operations: C
+//
+void Startup_Set_Operations(void)
+{
+    TG_Set_Check_Hashlist = Make_Hash_Sequence(SET_HASH_MIN);
+    TG_Set_Result_Hashlist = Make_Hash_Sequence(SET_HASH_MIN);
+    TG_Buf_Set = Make_Array_Core(SET_HASH_MIN, 0);
+}
+
+
+//
+//  Shutdown_Set_Operations: C
+//
+void Shutdown_Set_Operations(void)
+{
+    Free_Unmanaged_Array(TG_Buf_Set);
+    TG_Buf_Set = nullptr;
+    Free_Unmanaged_Series(TG_Set_Result_Hashlist);
+    TG_Set_Result_Hashlist = nullptr;
+    Free_Unmanaged_Series(TG_Set_Check_Hashlist);
+    TG_Set_Check_Hashlist = nullptr;
+}
+
+
+//
+//  Reset_Set_Hashlist: C
+//
+// Empty one of the reused hashlists, making sure it has room for `len` keys.
+// (It is never shrunk, as with the mold buffer.)
+//
+static void Reset_Set_Hashlist(REBSER *hashlist, REBLEN len)
+{
+    REBLEN capacity = Hashlist_Capacity_For(len);
+    if (SER_REST(hashlist) < Hashlist_Size(capacity) + 1)
+        Remake_Series(  // not(NODE_FLAG_NODE) => don't keep data
+            hashlist,
+            Hashlist_Size(capacity) + 1,
+            1,
+            SERIES_FLAG_POWER_OF_2
+        );
+    Init_Hashlist(hashlist, capacity);
+}
+
+
+//
+//  Find_Record_Linear: C
+//
+// Look for a record in `array` (starting at `index`) whose first value is
+// the same as `key` by the standards of Find_Hashed().  That includes having
+// the same Hash_Value(), so e.g. 1 and 1.0 aren't merged for small inputs
+// when they wouldn't be for big ones.
+//
+static bool Find_Record_Linear(
+    REBARR *array,
+    REBLEN index,
+    REBLEN skip,
+    const RELVAL *key,
+    uint32_t hash,
+    bool cased
+){
+    for (; index < ARR_LEN(array); index += skip) {
+        RELVAL *k = ARR_AT(array, index);
+        if (0 == Cmp_Value(k, key, cased) and Hash_Value(k) == hash)
+            return true;
+    }
+    return false;
+}
+
+
+//
+//  Fail_If_Set_Operation_Into: C
+//
+// INTERSECT, UNION and DIFFERENCE take /INTO, but only the ANY-SERIES! set
+// operations can insert their result into a series.  The types that do
+// these as math or bitwise operations call this so /INTO isn't ignored.
+//
+void Fail_If_Set_Operation_Into(REBFRM *frame_)
+{
+    INCLUDE_PARAMS_OF_DIFFERENCE;  // should all have same spec
+
+    UNUSED(ARG(value1));
+    UNUSED(ARG(value2));
+    UNUSED(REF(case));
+    UNUSED(ARG(skip));
+
+    if (REF(into))
+        fail (Error_Bad_Refine_Raw(ARG(into)));
+}
+
+
 //
 //  Make_Set_Operation_Series: C
 //
 // Do set operations on a series.  Case-sensitive if `cased` is TRUE.
 // `skip` is the record size.
 //
+// If `into` is given, the result is inserted into that series at its index
+// (with the index moved past the insertion) and nullptr is returned.
+//
 REBSER *Make_Set_Operation_Series(
     const REBVAL *val1,
     const REBVAL *val2,
     REBFLGS flags,
     bool cased,
-    REBLEN skip
+    REBLEN skip,
+    REBVAL *into
 ){
     assert(ANY_SERIES(val1));
 
+    if (into) {
+        if (ANY_ARRAY(val1) ? not ANY_ARRAY(into) : not ANY_STRING(into))
+            fail (Error_Unexpected_Type(VAL_TYPE(val1), VAL_TYPE(into)));
+        FAIL_IF_READ_ONLY(into);
+    }
+
     if (val2) {
         assert(ANY_SERIES(val2));
 
@@ -85,57 +201,92 @@ REBSER *Make_Set_Operation_Series(
     REBSER *out_ser;
 
     if (ANY_ARRAY(val1)) {
-        REBSER *hser = 0;   // hash table for series
-        REBSER *hret;       // hash table for return series
-
-        // The buffer used for building the return series.  This creates
-        // a new buffer every time, but reusing one might be slightly more
-        // efficient.
-        //
-        REBSER *buffer = SER(Make_Array(i));
-        hret = Make_Hash_Sequence(i);   // allocated
+        REBARR *buffer = TG_Buf_Set;
+        TERM_ARRAY_LEN(buffer, 0);  // may hold junk if last operation failed
 
-        // Optimization note: !!
-        // This code could be optimized for small blocks by not hashing them
-        // and extending Find_Key to FIND on the value itself w/o the hash.
+        bool hash_result = (i / skip >= SET_HASH_MIN);
+        if (hash_result)
+            Reset_Set_Hashlist(TG_Set_Result_Hashlist, i);
 
         do {
             REBARR *array1 = VAL_ARRAY(val1); // val1 and val2 swapped 2nd pass!
 
             // Check what is in series1 but not in series2
             //
-            if (flags & SOP_FLAG_CHECK)
-                hser = Hash_Block(val2, skip, cased);
+            bool hash_check = false;
+            if (flags & SOP_FLAG_CHECK) {
+                hash_check = (VAL_LEN_AT(val2) / skip >= SET_HASH_MIN);
+                if (hash_check) {
+                    Reset_Set_Hashlist(
+                        TG_Set_Check_Hashlist,
+                        VAL_LEN_AT(val2)
+                    );
+                    Hash_Block(TG_Set_Check_Hashlist, val2, skip, cased);
+                }
+                else if (VAL_LEN_AT(val2) % skip != 0)
+                    fail (Error_Block_Skip_Wrong_Raw());  // as Hash_Block()
+            }
 
             // Iterate over first series
             //
             i = VAL_INDEX(val1);
             for (; i < ARR_LEN(array1); i += skip) {
                 RELVAL *item = ARR_AT(array1, i);
+                uint32_t hash = 0;  // Find_Key_Hashed() calculates its own
+                if (
+                    not hash_result
+                    or ((flags & SOP_FLAG_CHECK) and not hash_check)
+                ){
+                    hash = Hash_Value(item);
+                }
+
                 if (flags & SOP_FLAG_CHECK) {
-                    h = Find_Key_Hashed(
-                        VAL_ARRAY(val2),
-                        hser,
-                        item,
-                        VAL_SPECIFIER(val1),
-                        skip,
-                        cased,
-                        1
-                    );
-                    h = (h >= 0);
+                    if (hash_check)
+                        h = (0 <= Find_Key_Hashed(
+                            VAL_ARRAY(val2),
+                            TG_Set_Check_Hashlist,
+                            item,
+                            VAL_SPECIFIER(val1),
+                            skip,
+                            cased,
+                            0  // search only
+                        ));
+                    else
+                        h = Find_Record_Linear(
+                            VAL_ARRAY(val2),
+                            VAL_INDEX(val2),
+                            skip,
+                            item,
+                            hash,
+                            cased
+                        );
                     if (flags & SOP_FLAG_INVERT) h = !h;
                 }
-                if (h) {
+                if (not h)
+                    continue;
+
+                if (hash_result) {
                     Find_Key_Hashed(
-                        ARR(buffer),
-                        hret,
+                        buffer,
+                        TG_Set_Result_Hashlist,
                         item,
                         VAL_SPECIFIER(val1),
                         skip,
                         cased,
-                        2
+                        1  // append to buffer if not found
                     );
                 }
+                else if (not Find_Record_Linear(
+                    buffer, 0, skip, item, hash, cased
+                )){
+                    REBLEN n;
+                    for (n = 0; n < skip and i + n < ARR_LEN(array1); ++n)
+                        Append_Value_Core(  // as Find_Key_Hashed() would
+                            buffer,
+                            item + n,
+                            VAL_SPECIFIER(val1)
+                        );
+                }
             }
 
             if (i != ARR_LEN(array1)) {
@@ -148,9 +299,6 @@ REBSER *Make_Set_Operation_Series(
                 fail (Error_Block_Skip_Wrong_Raw());
             }
 
-            if (flags & SOP_FLAG_CHECK)
-                Free_Unmanaged_Series(hser);
-
             if (not first_pass)
                 break;
             first_pass = false;
@@ -164,14 +312,31 @@ REBSER *Make_Set_Operation_Series(
             }
         } while (i);
 
-        if (hret)
-            Free_Unmanaged_Series(hret);
+        if (into) {
+            REBARR *dest = VAL_ARRAY(into);
+            REBLEN index = MIN(VAL_INDEX(into), ARR_LEN(dest));
+            REBLEN len = ARR_LEN(buffer);
+            Expand_Series(SER(dest), index, len);
+
+            REBLEN n;
+            for (n = 0; n < len; ++n)
+                Derelativize(
+                    ARR_AT(dest, index + n),
+                    ARR_AT(buffer, n),
+                    SPECIFIED
+                );
+
+            VAL_INDEX(into) = index + len;
+            out_ser = nullptr;
+        }
+        else {
+            // The buffer may have been allocated too large, so copy it at the
+            // used capacity size
+            //
+            out_ser = SER(Copy_Array_Shallow(buffer, SPECIFIED));
+        }
 
-        // The buffer may have been allocated too large, so copy it at the
-        // used capacity size
-        //
-        out_ser = SER(Copy_Array_Shallow(ARR(buffer), SPECIFIED));
-        Free_Unmanaged_Array(ARR(buffer));
+        TERM_ARRAY_LEN(buffer, 0);
     }
     else if (ANY_STRING(val1)) {
         DECLARE_MOLD (mo);
@@ -237,6 +402,20 @@ REBSER *Make_Set_Operation_Series(
         } while (i);
 
         out_ser = SER(Pop_Molded_String(mo));
+
+        if (into) {
+            DECLARE_LOCAL (result);
+            Init_Text(result, STR(out_ser));
+            VAL_INDEX(into) = Modify_String_Or_Binary(
+                into,
+                Canon(SYM_INSERT),
+                result,
+                0,  // no AM_PART
+                STR_LEN(STR(out_ser)),
+                1  // dup count
+            );
+            out_ser = nullptr;
+        }
     }
     else {
         assert(IS_BINARY(val1) and IS_BINARY(val2));
@@ -331,6 +510,8 @@ REBSER *Make_Set_Operation_Series(
 //      /case "Uses case-sensitive comparison"
 //      /skip "Treat the series as records of fixed size"
 //          [integer!]
+//      /into "Insert the result into a series (returns position after it)"
+//          [any-array! any-string!]
 //  ]
 //
 REBNATIVE(exclude)
@@ -340,6 +521,14 @@ REBNATIVE(exclude)
     REBVAL *val1 = ARG(series);
     REBVAL *val2 = ARG(exclusions);
 
+    if (
+        (IS_BITSET(val1) or IS_TYPESET(val1)
+            or IS_BITSET(val2) or IS_TYPESET(val2))
+        and REF(into)
+    ){
+        fail (Error_Bad_Refine_Raw(ARG(into)));
+    }
+
     if (IS_BITSET(val1) || IS_BITSET(val2)) {
         if (VAL_TYPE(val1) != VAL_TYPE(val2))
             fail (Error_Unexpected_Type(VAL_TYPE(val1), VAL_TYPE(val2)));
@@ -369,17 +558,18 @@ REBNATIVE(exclude)
         return D_OUT;
     }
 
-    return Init_Any_Series(
-        D_OUT,
-        VAL_TYPE(val1),
-        Make_Set_Operation_Series(
-            val1,
-            val2,
-            SOP_FLAG_CHECK | SOP_FLAG_INVERT,
-            did REF(case),
-            REF(skip) ? Int32s(ARG(skip), 1) : 1
-        )
+    REBSER *ser = Make_Set_Operation_Series(
+        val1,
+        val2,
+        SOP_FLAG_CHECK | SOP_FLAG_INVERT,
+        did REF(case),
+        REF(skip) ? Int32s(ARG(skip), 1) : 1,
+        REF(into) ? ARG(into) : nullptr
     );
+    if (not ser)
+        RETURN (ARG(into));
+
+    return Init_Any_Series(D_OUT, VAL_TYPE(val1), ser);
 }
 
 
@@ -392,6 +582,8 @@ REBNATIVE(exclude)
 //      /case "Use case-sensitive comparison (except bitsets)"
 //      /skip "Treat the series as records of fixed size"
 //          [integer!]
+//      /into "Insert the result into a series (returns position after it)"
+//          [any-array! any-string!]
 //  ]
 //
 REBNATIVE(unique)
@@ -400,18 +592,22 @@ REBNATIVE(unique)
 
     REBVAL *val = ARG(series);
 
-    if (IS_BITSET(val) or IS_TYPESET(val))
+    if (IS_BITSET(val) or IS_TYPESET(val)) {
+        if (REF(into))
+            fail (Error_Bad_Refine_Raw(ARG(into)));
         return val; // bitsets & typesets already unique (by definition)
+    }
 
-    return Init_Any_Series(
-        D_OUT,
-        VAL_TYPE(val),
-        Make_Set_Operation_Series(
-            val,
-            NULL,
-            SOP_NONE,
-            did REF(case),
-            REF(skip) ? Int32s(ARG(skip), 1) : 1
-        )
+    REBSER *ser = Make_Set_Operation_Series(
+        val,
+        NULL,
+        SOP_NONE,
+        did REF(case),
+        REF(skip) ? Int32s(ARG(skip), 1) : 1,
+        REF(into) ? ARG(into) : nullptr
     );
+    if (not ser)
+        RETURN (ARG(into));
+
+    return Init_Any_Series(D_OUT, VAL_TYPE(val), ser);
 }
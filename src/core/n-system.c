@@ -105,6 +105,14 @@ REBNATIVE(exit_rebol)
 //      /ballast "Trigger for auto-recycle (memory used)"
 //          [integer!]
 //      /torture "Constant recycle (for internal debugging)"
+//      /minor "Only recycle series made since the last recycle"
+//      /generational "Make most automatic recycles minor ones"
+//          [logic!]
+//      /budget "Do full automatic recycles in slices of about this long"
+//          [time! integer!]  ; INTEGER! is microseconds, 0 turns it off
+//      /lazy "Make automatic recycles leave sweeping to allocations"
+//          [logic!]
+//      /trim "Give memory in wholly unused pool segments back to the system"
 //      /watch "Monitor recycling (debug only)"
 //      /verbose "Dump information about series being recycled (debug only)"
 //  ]
@@ -133,12 +141,36 @@ REBNATIVE(recycle)
         TG_Ballast = 0;
     }
 
+    if (REF(generational))
+        GC_Generational = VAL_LOGIC(ARG(generational));
+
+    if (REF(budget)) {
+        REBI64 budget;
+        if (IS_TIME(ARG(budget)))
+            budget = VAL_NANO(ARG(budget)) / 1000;
+        else
+            budget = VAL_INT64(ARG(budget));
+
+        if (budget < 0)
+            fail (Error_Out_Of_Range(ARG(budget)));
+        GC_Budget = budget;
+    }
+
+    if (REF(lazy))
+        GC_Lazy = VAL_LOGIC(ARG(lazy));
+
     if (GC_Disabled)
         return nullptr; // don't give misleading "0", since no recycle ran
 
     REBLEN count;
 
-    if (REF(verbose)) {
+    if (REF(minor)) {
+        if (REF(verbose))
+            fail (Error_Bad_Refines_Raw());
+
+        count = Recycle_Minor();
+    }
+    else if (REF(verbose)) {
       #if defined(NDEBUG)
         fail (Error_Debug_Only_Raw());
       #else
@@ -163,6 +195,9 @@ REBNATIVE(recycle)
         count = Recycle();
     }
 
+    if (REF(trim))
+        Trim_Pools(false);
+
     if (REF(watch)) {
       #if defined(NDEBUG)
         fail (Error_Debug_Only_Raw());
@@ -136,38 +136,207 @@ REBINT Compute_CRC24(const REBYTE *str, REBLEN len)
 }
 
 
+//=//// 64-BIT WORD-AT-A-TIME HASHING ///////////////////////////////////=//
+//
+// R3-Alpha hashed strings with a CRC table lookup per byte, which is slow
+// (one dependent table load per byte) and only gave 24 bits.  These hashes
+// instead consume whole 64-bit words per step, using the "round" and
+// "avalanche" steps from xxHash64.  They are not bit-compatible with
+// xxHash64 (the tail handling is simplified), so don't persist results and
+// expect them to match other implementations.
+//
+// Words are loaded little-endian on all platforms, so CHECKSUM 'HASH64 gives
+// the same answer everywhere.
+//
+
+#define HASH64_P1 0x9E3779B185EBCA87ULL
+#define HASH64_P2 0xC2B2AE3D27D4EB4FULL
+#define HASH64_P3 0x165667B19E3779F9ULL
+#define HASH64_P4 0x85EBCA77C2B2AE63ULL
+#define HASH64_P5 0x27D4EB2F165667C5ULL
+
+#define ROTL64(x,r) \
+    (((x) << (r)) | ((x) >> (64 - (r))))
+
+inline static uint64_t Load_U64_LE(const REBYTE *p) {
+    uint64_t w;
+    memcpy(&w, p, sizeof(uint64_t));
+  #if defined(ENDIAN_BIG)
+    w = ((w & 0x00000000FFFFFFFFULL) << 32) | (w >> 32);
+    w = ((w & 0x0000FFFF0000FFFFULL) << 16)
+        | ((w & 0xFFFF0000FFFF0000ULL) >> 16);
+    w = ((w & 0x00FF00FF00FF00FFULL) << 8)
+        | ((w & 0xFF00FF00FF00FF00ULL) >> 8);
+  #endif
+    return w;
+}
+
+inline static uint64_t Hash64_Round(uint64_t acc, uint64_t w) {
+    acc += w * HASH64_P2;
+    acc = ROTL64(acc, 31);
+    return acc * HASH64_P1;
+}
+
+inline static uint64_t Hash64_Merge_Word(uint64_t h, uint64_t w) {
+    h ^= Hash64_Round(0, w);
+    return ROTL64(h, 27) * HASH64_P1 + HASH64_P4;
+}
+
+inline static uint64_t Hash64_Avalanche(uint64_t h) {
+    h ^= h >> 33;
+    h *= HASH64_P2;
+    h ^= h >> 29;
+    h *= HASH64_P3;
+    h ^= h >> 32;
+    return h;
+}
+
+// Lowercase 8 ASCII bytes at once.  Because each byte is < 0x80, the adds
+// can't carry into the next byte: the high bit of each byte of `ge_A` is set
+// if the byte is >= 'A', and of `gt_Z` if it is > 'Z'.  Uppercase letters are
+// those with the first and not the second, and 0x80 >> 2 is 0x20, the bit
+// that distinguishes upper and lower case in ASCII.
+//
+inline static uint64_t Lowercase_Ascii_U64(uint64_t w) {
+    assert(not (w & 0x8080808080808080ULL));
+    uint64_t ge_A = w + (0x0101010101010101ULL * (0x80 - 'A'));
+    uint64_t gt_Z = w + (0x0101010101010101ULL * (0x7F - 'Z'));
+    uint64_t upper = ge_A & ~gt_Z & 0x8080808080808080ULL;
+    return w | (upper >> 2);
+}
+
+
 //
-//  Hash_UTF8: C
+//  Hash64_Bytes: C
 //
-// Return a case insensitive hash value for the string.
+// Case-sensitive 64-bit hash of bytes, consuming 16 bytes per step in two
+// independent lanes (so the multiplies can overlap).
 //
-REBINT Hash_UTF8(const REBYTE *utf8, REBSIZ size)
+uint64_t Hash64_Bytes(const REBYTE *data, REBSIZ size)
 {
-    REBINT hash =
-        cast(REBINT, size) + cast(REBINT, cast(REBYTE, LO_CASE(*utf8)));
+    const REBYTE *p = data;
+    const REBYTE *tail = data + size;
+
+    uint64_t h;
+    if (size >= 16) {
+        uint64_t v1 = HASH64_P1 + HASH64_P2;
+        uint64_t v2 = HASH64_P2;
+        do {
+            v1 = Hash64_Round(v1, Load_U64_LE(p));
+            v2 = Hash64_Round(v2, Load_U64_LE(p + 8));
+            p += 16;
+        } while (tail - p >= 16);
+        h = ROTL64(v1, 1) + ROTL64(v2, 7);
+    }
+    else
+        h = HASH64_P5;
 
-    for (; size != 0; ++utf8, --size) {
-        REBUNI n = *utf8;
+    h += size;
 
-        if (n >= 0x80) {
-            utf8 = Back_Scan_UTF8_Char(&n, utf8, &size);
-            assert(utf8 != NULL); // should have already been verified good
-        }
+    if (tail - p >= 8) {
+        h = Hash64_Merge_Word(h, Load_U64_LE(p));
+        p += 8;
+    }
 
-        // Optimize `n = cast(REBYTE, LO_CASE(n))` (drop upper 8 bits)
-        // !!! Is this actually faster?
-        //
-        n = cast(REBYTE, LO_CASE(n));
+    if (p != tail) {  // 1 to 7 bytes left, pack them into a word
+        uint64_t w = 0;
+        REBLEN shift = 0;
+        for (; p != tail; ++p, shift += 8)
+            w |= cast(uint64_t, *p) << shift;
+        h = Hash64_Merge_Word(h, w);
+    }
+
+    return Hash64_Avalanche(h);
+}
 
-        n = cast(REBYTE, (hash >> CRCSHIFTS) ^ n);
 
-        // Left shift math must use unsigned to avoid undefined behavior
-        // http://stackoverflow.com/q/3784996/211160
-        //
-        hash = cast(REBINT, MASK_CRC(cast(REBLEN, hash) << 8) ^ crc24_table[n]);
+//
+//  Hash64_UTF8_Caseless: C
+//
+// Case-insensitive 64-bit hash of UTF-8 data, which must be valid.  This is
+// a hash of the UTF-8 bytes of the lowercased codepoints, so all casings of
+// a string hash the same.
+//
+// Runs of 8 ASCII bytes are lowercased and mixed a word at a time.  Other
+// codepoints are lowercased one by one and have their UTF-8 bytes pushed
+// into a pending word.  ASCII words that arrive while the pending word is
+// partially filled are shifted in, so the result doesn't depend on which
+// path the bytes took.
+//
+uint64_t Hash64_UTF8_Caseless(const REBYTE *utf8, REBSIZ size)
+{
+    const REBYTE *tail = utf8 + size;
+
+    uint64_t h = HASH64_P5;
+    uint64_t pending = 0;  // folded bytes not mixed in yet, little-endian
+    REBLEN shift = 0;  // bits in `pending` that are used (multiple of 8)
+    REBSIZ folded_size = 0;  // lowercasing can change the UTF-8 size
+
+    while (utf8 != tail) {
+        while (tail - utf8 >= 8) {  // fast path for ASCII words
+            uint64_t w = Load_U64_LE(utf8);
+            if (w & 0x8080808080808080ULL)
+                break;
+            w = Lowercase_Ascii_U64(w);
+            if (shift == 0)
+                h = Hash64_Merge_Word(h, w);
+            else {
+                h = Hash64_Merge_Word(h, pending | (w << shift));
+                pending = w >> (64 - shift);
+            }
+            utf8 += 8;
+            folded_size += 8;
+        }
+        if (utf8 == tail)
+            break;
+
+        REBYTE encoded[4];
+        uint_fast8_t encoded_size;
+
+        REBUNI c = *utf8;
+        if (c < 0x80) {
+            if (c >= 'A' and c <= 'Z')
+                c += 'a' - 'A';
+            encoded[0] = cast(REBYTE, c);
+            encoded_size = 1;
+        }
+        else {
+            utf8 = Back_Scan_UTF8_Char_Unchecked(&c, utf8);
+            c = LO_CASE(c);
+            encoded_size = Encoded_Size_For_Codepoint(c);
+            Encode_UTF8_Char(encoded, c, encoded_size);
+        }
+        ++utf8;  // Back_Scan leaves pointer on last byte of codepoint
+
+        uint_fast8_t i;
+        for (i = 0; i < encoded_size; ++i) {
+            pending |= cast(uint64_t, encoded[i]) << shift;
+            shift += 8;
+            if (shift == 64) {
+                h = Hash64_Merge_Word(h, pending);
+                pending = 0;
+                shift = 0;
+            }
+        }
+        folded_size += encoded_size;
     }
 
-    return hash;
+    if (shift != 0)
+        h = Hash64_Merge_Word(h, pending);
+
+    return Hash64_Avalanche(h + folded_size);
+}
+
+
+//
+//  Hash_UTF8: C
+//
+// Return a case insensitive hash value for the string.
+//
+REBINT Hash_UTF8(const REBYTE *utf8, REBSIZ size)
+{
+    uint64_t h = Hash64_UTF8_Caseless(utf8, size);
+    return cast(REBINT, cast(int32_t, cast(uint32_t, h ^ (h >> 32))));
 }
 
 
@@ -264,12 +433,21 @@ uint32_t Hash_Value(const RELVAL *v)
       case REB_EMAIL:
       case REB_URL:
       case REB_TAG:
-      case REB_ISSUE:
-        hash = Hash_UTF8_Caseless(
-            VAL_STRING_AT(cell),
-            VAL_LEN_AT(cell)
-        );
-        break;
+      case REB_ISSUE: {
+        REBSTR *s = VAL_STRING(cell);
+        if (
+            VAL_INDEX(cell) == 0
+            and not IS_STR_SYMBOL(s)
+            and GET_SERIES_INFO(s, FROZEN)
+        ){
+            hash = Hash_Frozen_String(s);
+        }
+        else {
+            REBCHR(const*) at = VAL_STRING_AT(cell);
+            REBCHR(const*) tail = VAL_STRING_TAIL(cell);
+            hash = Hash_UTF8(at, tail - at);
+        }
+        break; }
 
       case REB_PATH:
       case REB_SET_PATH:
@@ -395,12 +573,14 @@ uint32_t Hash_Value(const RELVAL *v)
 //
 //  Make_Hash_Sequence: C
 //
+// Make an empty hashlist with room for at least `len` keys.  See %sys-map.h
+// for the layout.
+//
 REBSER *Make_Hash_Sequence(REBLEN len)
 {
-    REBLEN n = Get_Hash_Prime_May_Fail(len * 2);  // best when 2X # of keys
-    REBSER *ser = Make_Series(n + 1, sizeof(REBLEN));
-    Clear_Series(ser);
-    SET_SERIES_LEN(ser, n);
+    REBLEN capacity = Hashlist_Capacity_For(len);
+    REBSER *ser = Make_Series(Hashlist_Size(capacity) + 1, sizeof(REBYTE));
+    Init_Hashlist(ser, capacity);
 
     return ser;
 }
@@ -431,35 +611,40 @@ REBVAL *Init_Map(RELVAL *out, REBMAP *map)
 //
 //  Hash_Block: C
 //
-// Hash ALL values of a block. Return hash array series.
-// Used for SET logic (unique, union, etc.)
+// Hash ALL values of a block into `hashlist`, which must be empty and have
+// room for VAL_LEN_AT(block) keys.  Used for SET logic (unique, union, etc.)
 //
-// Note: hash array contents (indexes) are 1-based!
+// Note: record indexes in the hashlist slots are 1-based!  If a value occurs
+// more than once, only its first record is indexed.
 //
-REBSER *Hash_Block(const REBVAL *block, REBLEN skip, bool cased)
-{
-    REBLEN n;
-    REBSER *hashlist;
-    REBLEN *hashes;
-    REBARR *array = VAL_ARRAY(block);
-    RELVAL *value;
+void Hash_Block(
+    REBSER *hashlist,
+    const REBVAL *block,
+    REBLEN skip,
+    bool cased
+){
+    assert(HASHLIST_HEADER(hashlist)->count == 0);
+    assert(
+        HASHLIST_MAX_LOAD(HASHLIST_CAPACITY(hashlist)) > VAL_LEN_AT(block)
+    );
 
-    // Create the hash array (integer indexes):
-    hashlist = Make_Hash_Sequence(VAL_LEN_AT(block));
-    hashes = SER_HEAD(REBLEN, hashlist);
+    REBARR *array = VAL_ARRAY(block);
+    REBSPC *specifier = VAL_SPECIFIER(block);
 
-    value = VAL_ARRAY_AT(block);
+    RELVAL *value = VAL_ARRAY_AT(block);
     if (IS_END(value))
-        return hashlist;
+        return;
 
-    n = VAL_INDEX(block);
+    REBLEN n = VAL_INDEX(block);
     while (true) {
         REBLEN skip_index = skip;
 
-        REBLEN hash = Find_Key_Hashed(
-            array, hashlist, value, VAL_SPECIFIER(block), 1, cased, 0
-        );
-        hashes[hash] = (n / skip) + 1;
+        uint32_t hash = Mix_Hash(Hash_Value(value));
+        if (-1 == Find_Hashed(
+            array, hashlist, value, specifier, skip, cased, hash
+        )){
+            Add_Hashlist_Entry(hashlist, hash, (n / skip) + 1);
+        }
 
         while (skip_index != 0) {
             value++;
@@ -485,7 +670,7 @@ REBSER *Hash_Block(const REBVAL *block, REBLEN skip, bool cased)
                     fail (Error_Block_Skip_Wrong_Raw());
                 }
 
-                return hashlist;
+                return;
             }
         }
     }
@@ -528,51 +713,47 @@ REBINT Compute_IPC(REBYTE *data, REBLEN length)
 // Return a 32-bit hash value for the bytes.
 //
 REBINT Hash_Bytes(const REBYTE *data, REBLEN len) {
-    uint32_t crc = 0x00000000;
-
-    REBLEN n;
-    for (n = 0; n != len; ++n)
-        crc = (crc >> 8) ^ crc32_table[(crc ^ data[n]) & 0xff];
-
-    return cast(REBINT, ~crc);
+    uint64_t h = Hash64_Bytes(data, len);
+    return cast(REBINT, cast(int32_t, cast(uint32_t, h ^ (h >> 32))));
 }
 
 
 //
-//  Hash_UTF8_Caseless: C
+//  Hash_Frozen_String: C
 //
-// Return a 32-bit case insensitive hash value for UTF-8 data.  Length is in
-// characters, not bytes.
+// Strings used as MAP! keys are frozen, and are often looked up with other
+// frozen strings (e.g. LOCK'd text).  Since they can never change, their
+// case-folded hash is memoized in the string's bookmark so it's only walked
+// once.  The hash is only cached for frozen strings: not every path that
+// writes string data goes through Free_Bookmarks_Maybe_Null(), so a cache on
+// a mutable string could go stale.
 //
-// !!! See redundant code in Hash_UTF8 which takes a size, not a length
+// Short strings don't get bookmarks (STR_AT() asserts this), but they're
+// cheap to hash anyway.
 //
-REBINT Hash_UTF8_Caseless(const REBYTE *utf8, REBLEN len) {
-    //
-    // Note: can't make the argument a REBCHR() because the C++ build and C
-    // build can't have different ABIs for %sys-core.h
-    //
-    REBCHR(const*) cp = cast(REBCHR(const*), utf8);
+uint32_t Hash_Frozen_String(REBSTR *s)
+{
+    assert(GET_SERIES_INFO(s, FROZEN));
+    assert(not IS_STR_SYMBOL(s));
 
-    uint32_t crc = 0x00000000;
+    REBBMK *bookmark = LINK(s).bookmarks;
+    if (bookmark and BMK_HASH(bookmark) != 0)
+        return cast(uint32_t, BMK_HASH(bookmark));
 
-    REBLEN n;
-    for (n = 0; n < len; n++) {
-        REBUNI c;
-        cp = NEXT_CHR(&c, cp);
+    uint32_t hash = Hash_String(s);
 
-        c = LO_CASE(c);
+    if (STR_LEN(s) < sizeof(REBVAL))
+        return hash;
 
-        // !!! This takes into account all 4 bytes of the lowercase codepoint
-        // for the CRC calculation.  In ASCII strings this will involve a lot
-        // of zeros.  Review if there's a better way.
-        //
-        crc = (crc >> 8) ^ crc32_table[(crc ^ c) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 8)) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 16)) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 24)) & 0xff];
+    if (not bookmark) {
+        bookmark = Alloc_Bookmark();
+        BMK_INDEX(bookmark) = 0;  // valid mapping if STR_AT() looks at it
+        BMK_OFFSET(bookmark) = 0;
+        LINK(s).bookmarks = bookmark;
     }
+    BMK_HASH(bookmark) = hash;  // a hash of 0 just won't be remembered
 
-    return cast(REBINT, ~crc);
+    return hash;
 }
 
 
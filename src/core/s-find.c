@@ -23,6 +23,301 @@
 //
 
 #include "sys-core.h"
+#include "sys-simd.h"
+
+#if defined(__SSSE3__) || defined(__AVX__)
+    #include <tmmintrin.h>  // PSHUFB, for BITSET! scanning
+    #define FIND_BYTES_SSSE3
+#endif
+
+
+//=//// BYTE SEARCH KERNELS ///////////////////////////////////////////////=//
+//
+// Searching UTF-8 can mostly be done on raw bytes: a codepoint's encoding
+// never occurs in the middle of another's, so a byte-for-byte match of valid
+// UTF-8 is a codepoint-for-codepoint match.  The kernels below find match
+// candidates 16 bytes at a time where SSE2 is available, else they lean on
+// memchr() (which the C library vectorizes).  Codepoint indexes are only
+// counted once a match is found.
+//
+
+// Find the first occurrence of `size` bytes at `pat` lying entirely inside
+// of [bp, ep).  With SSE2, positions are filtered on the first *and* last
+// byte of the pattern matching, so memcmp() only runs on likely hits.
+//
+static const REBYTE *Find_Bytes(
+    const REBYTE *bp,
+    const REBYTE *ep,
+    const REBYTE *pat,
+    REBSIZ size
+){
+    assert(size != 0);
+
+  #if defined(REB_SSE2)
+    if (size > 1) {
+        __m128i first = _mm_set1_epi8(cast(char, pat[0]));
+        __m128i last = _mm_set1_epi8(cast(char, pat[size - 1]));
+
+        while (cast(REBSIZ, ep - bp) >= 16 + size - 1) {
+            __m128i f = _mm_loadu_si128(cast(const __m128i*, bp));
+            __m128i l = _mm_loadu_si128(cast(const __m128i*, bp + size - 1));
+            __m128i both = _mm_and_si128(
+                _mm_cmpeq_epi8(f, first), _mm_cmpeq_epi8(l, last)
+            );
+            unsigned int mask = cast(uint16_t, _mm_movemask_epi8(both));
+            while (mask != 0) {
+                REBLEN i = Lowest_Set_Bit(mask);
+                if (memcmp(bp + i + 1, pat + 1, size - 2) == 0)
+                    return bp + i;
+                mask &= mask - 1;
+            }
+            bp += 16;
+        }
+    }
+  #endif
+
+    while (cast(REBSIZ, ep - bp) >= size) {
+        bp = cast(const REBYTE*, memchr(bp, pat[0], (ep - bp) - size + 1));
+        if (not bp)
+            return nullptr;
+        if (memcmp(bp + 1, pat + 1, size - 1) == 0)
+            return bp;
+        ++bp;
+    }
+    return nullptr;
+}
+
+// Find the first byte in [bp, ep) which is any of the `num` bytes in `set`
+// (up to 4).  Used for caseless search, where a match can start with more
+// than one byte.
+//
+static const REBYTE *Find_Byte_In_Set(
+    const REBYTE *bp,
+    const REBYTE *ep,
+    const REBYTE *set,
+    REBLEN num
+){
+    assert(num >= 1 and num <= 4);
+
+    if (num == 1)
+        return cast(const REBYTE*, memchr(bp, set[0], ep - bp));
+
+  #if defined(REB_SSE2)
+    __m128i s0 = _mm_set1_epi8(cast(char, set[0]));
+    __m128i s1 = _mm_set1_epi8(cast(char, set[1]));
+    __m128i s2 = _mm_set1_epi8(cast(char, set[num > 2 ? 2 : 1]));
+    __m128i s3 = _mm_set1_epi8(cast(char, set[num > 3 ? 3 : 1]));
+
+    while (ep - bp >= 16) {
+        __m128i b = _mm_loadu_si128(cast(const __m128i*, bp));
+        __m128i eq = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(b, s0), _mm_cmpeq_epi8(b, s1)),
+            _mm_or_si128(_mm_cmpeq_epi8(b, s2), _mm_cmpeq_epi8(b, s3))
+        );
+        unsigned int mask = cast(uint16_t, _mm_movemask_epi8(eq));
+        if (mask != 0)
+            return bp + Lowest_Set_Bit(mask);
+        bp += 16;
+    }
+  #endif
+
+    for (; bp != ep; ++bp) {
+        REBLEN n;
+        for (n = 0; n != num; ++n)
+            if (*bp == set[n])
+                return bp;
+    }
+    return nullptr;
+}
+
+// Gather the bytes a caseless match for a codepoint could start with.  Only
+// ASCII is handled, and false is returned otherwise.  Note LO_CASE() folds
+// two non-ASCII codepoints to ASCII letters (see Char_Cases[] in s-cases.c),
+// so their lead bytes are candidates as well.
+//
+static bool Get_Caseless_Lead_Bytes(REBYTE set[4], REBLEN *num, REBUNI c) {
+    if (c >= 0x80)
+        return false;
+
+    REBLEN n = 0;
+    set[n++] = cast(REBYTE, LO_CASE(c));
+    if (UP_CASE(c) != LO_CASE(c))
+        set[n++] = cast(REBYTE, UP_CASE(c));
+
+    if (LO_CASE(c) == 's')
+        set[n++] = 0xC5;  // U+017F LATIN SMALL LETTER LONG S is C5 BF
+    else if (LO_CASE(c) == 'k')
+        set[n++] = 0xE2;  // U+212A KELVIN SIGN is E2 84 AA
+
+    *num = n;
+    return true;
+}
+
+// Number of codepoints encoded in [bp, ep), which must be valid UTF-8.
+//
+inline static REBLEN Count_Codepoints(const REBYTE *bp, const REBYTE *ep) {
+    REBLEN count = 0;
+    for (; bp != ep; ++bp)
+        count += ((*bp & 0xC0) != 0x80);  // don't count continuation bytes
+    return count;
+}
+
+
+//=//// BITSET SCANNING ///////////////////////////////////////////////////=//
+//
+// Matching a BITSET! against each codepoint with Check_Bit() is slow when a
+// charset is used to skip over (or find) long runs of text.  So the bitset's
+// membership for byte values is flattened into a 256-bit "stop" table, which
+// says which bytes end a scan.  Where SSSE3 is available this table is also
+// split by nibble, so PSHUFB can look up 16 bytes at once: the low nibble of
+// each byte selects a mask of which high nibbles stop, and the high nibble
+// selects the bit to test in that mask.
+//
+// Only bytes whose meaning is unambiguous are decided by the table.  In UTF-8
+// strings that is ASCII, so any byte 0x80 and up stops the scan for the
+// caller to decode a codepoint and use Check_Bit().  The same goes for bytes
+// of a BINARY! checked caselessly, since e.g. UP_CASE(0xFF) is U+0178.
+//
+// Building a table costs 256 Check_Bit() calls, so a few tables are cached.
+// They're keyed by the bitset's content rather than its identity, so there
+// is nothing to invalidate when a bitset is modified or freed: membership of
+// the bytes depends only on the first 32 bytes of bits and the BITS_NOT().
+//
+
+#if defined(FIND_BYTES_SSSE3)
+    static const REBYTE Nibble_Bits[16] = {
+        0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+        0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80
+    };
+#endif
+
+#define BYTE_CLASS_USED 0x01
+#define BYTE_CLASS_NOT 0x02  // bitset had BITS_NOT()
+#define BYTE_CLASS_UNCASE 0x04  // membership was tested caselessly
+#define BYTE_CLASS_HIGH 0x08  // bytes 0x80 and up are decided by the table
+#define BYTE_CLASS_SPAN 0x10  // stop on non-members, vs. on members
+
+struct Reb_Byte_Class {
+    REBYTE key[32];  // first 256 bits of the bitset, zero padded
+    REBFLGS mode;  // BYTE_CLASS_XXX flags, 0 if the slot is unused
+    REBYTE stop[32];  // bit set if scanning stops on that byte
+  #if defined(FIND_BYTES_SSSE3)
+    REBYTE low[16];  // by low nibble, bits for high nibbles 0-7 that stop
+    REBYTE high[16];  // by low nibble, bits for high nibbles 8-F that stop
+  #endif
+};
+
+#define NUM_BYTE_CLASSES 8
+
+static struct Reb_Byte_Class Byte_Classes[NUM_BYTE_CLASSES];
+static REBLEN Byte_Class_Next;  // round-robin replacement
+
+inline static bool Is_Stop_Byte(const struct Reb_Byte_Class *cls, REBYTE b)
+  { return did (cls->stop[b >> 3] & (1 << (b & 7))); }
+
+static const struct Reb_Byte_Class *Get_Byte_Class(
+    REBSER *bset,
+    bool uncase,
+    bool high,
+    bool span
+){
+    REBYTE key[32];
+    REBLEN size = SER_LEN(bset) < 32 ? SER_LEN(bset) : 32;
+    memcpy(key, BIN_HEAD(bset), size);
+    memset(key + size, 0, 32 - size);
+
+    REBFLGS mode = BYTE_CLASS_USED;
+    if (BITS_NOT(bset))
+        mode |= BYTE_CLASS_NOT;
+    if (uncase)
+        mode |= BYTE_CLASS_UNCASE;
+    if (high)
+        mode |= BYTE_CLASS_HIGH;
+    if (span)
+        mode |= BYTE_CLASS_SPAN;
+
+    REBLEN n;
+    for (n = 0; n < NUM_BYTE_CLASSES; ++n) {
+        struct Reb_Byte_Class *cls = &Byte_Classes[n];
+        if (cls->mode == mode and memcmp(cls->key, key, 32) == 0)
+            return cls;
+    }
+
+    struct Reb_Byte_Class *cls = &Byte_Classes[Byte_Class_Next];
+    Byte_Class_Next = (Byte_Class_Next + 1) % NUM_BYTE_CLASSES;
+
+    memcpy(cls->key, key, 32);
+    cls->mode = mode;
+    memset(cls->stop, 0, 32);
+  #if defined(FIND_BYTES_SSSE3)
+    memset(cls->low, 0, 16);
+    memset(cls->high, 0, 16);
+  #endif
+
+    REBLEN b;
+    for (b = 0; b < 256; ++b) {
+        bool stop;
+        if (b >= 0x80 and not high)
+            stop = true;  // caller must decide with Check_Bit()
+        else {
+            // LO_CASE() asserts on NUL, which has no case anyway
+            //
+            bool member = Check_Bit(bset, b, uncase and b != 0);
+            stop = span ? not member : member;
+        }
+        if (not stop)
+            continue;
+
+        cls->stop[b >> 3] |= (1 << (b & 7));
+      #if defined(FIND_BYTES_SSSE3)
+        if (b < 0x80)
+            cls->low[b & 0x0F] |= Nibble_Bits[b >> 4];
+        else
+            cls->high[b & 0x0F] |= Nibble_Bits[b >> 4];
+      #endif
+    }
+
+    return cls;
+}
+
+// Find the first byte in [bp, ep) which the class says to stop on, or ep.
+//
+static const REBYTE *Find_Stop_Byte(
+    const REBYTE *bp,
+    const REBYTE *ep,
+    const struct Reb_Byte_Class *cls
+){
+  #if defined(FIND_BYTES_SSSE3)
+    __m128i low = _mm_loadu_si128(cast(const __m128i*, cls->low));
+    __m128i high = _mm_loadu_si128(cast(const __m128i*, cls->high));
+    __m128i bits = _mm_loadu_si128(cast(const __m128i*, Nibble_Bits));
+    __m128i nibble = _mm_set1_epi8(0x0F);
+    __m128i zero = _mm_setzero_si128();
+
+    while (ep - bp >= 16) {
+        __m128i b = _mm_loadu_si128(cast(const __m128i*, bp));
+        __m128i lo = _mm_and_si128(b, nibble);
+        __m128i hi = _mm_and_si128(_mm_srli_epi16(b, 4), nibble);
+        __m128i is_high = _mm_cmplt_epi8(b, zero);  // signed, so 0x80 and up
+        __m128i row = _mm_or_si128(
+            _mm_andnot_si128(is_high, _mm_shuffle_epi8(low, lo)),
+            _mm_and_si128(is_high, _mm_shuffle_epi8(high, lo))
+        );
+        __m128i hit = _mm_and_si128(row, _mm_shuffle_epi8(bits, hi));
+        unsigned int mask = cast(uint16_t,
+            ~_mm_movemask_epi8(_mm_cmpeq_epi8(hit, zero))
+        );
+        if (mask != 0)
+            return bp + Lowest_Set_Bit(mask);
+        bp += 16;
+    }
+  #endif
+
+    for (; bp != ep; ++bp)
+        if (Is_Stop_Byte(cls, *bp))
+            return bp;
+    return ep;
+}
 
 
 //
@@ -242,27 +537,18 @@ REBLEN Find_Bin_In_Bin(
     if (size2 == 0 || (size2 + offset) > BIN_LEN(series))
         return NOT_FOUND; // pattern empty or is longer than the target
 
-    REBYTE *bp1 = BIN_AT(series, offset);
-    REBLEN size1 = BIN_LEN(series) - offset;
-
-    REBYTE *end1 = bp1 + ((flags & AM_FIND_MATCH) ? 1 : size1 - (size2 - 1));
-
-    REBYTE b2 = *bp2; // first byte
+    const REBYTE *bp1 = BIN_AT(series, offset);
 
-    while (bp1 != end1) {
-        if (*bp1 == b2) { // matched first byte
-            REBLEN n;
-            for (n = 1; n < size2; n++) {
-                if (bp1[n] != bp2[n])
-                    break;
-            }
-            if (n == size2)
-                return bp1 - BIN_HEAD(series);
-        }
-        ++bp1;
+    if (flags & AM_FIND_MATCH) {
+        if (memcmp(bp1, bp2, size2) == 0)
+            return offset;
+        return NOT_FOUND;
     }
 
-    return NOT_FOUND;
+    const REBYTE *found = Find_Bytes(bp1, BIN_TAIL(series), bp2, size2);
+    if (not found)
+        return NOT_FOUND;
+    return found - BIN_HEAD(series);
 }
 
 
@@ -316,7 +602,22 @@ REBLEN Find_Str_In_Bin(
     next2 = NEXT_CHR(&c2_canon, next2);
     c2_canon = LO_CASE(c2_canon);
 
+    REBYTE leads[4];  // bytes a match can start with, if c2 is ASCII
+    REBLEN num_leads;
+    if (
+        (flags & AM_FIND_MATCH)
+        or not Get_Caseless_Lead_Bytes(leads, &num_leads, c2_canon)
+    ){
+        num_leads = 0;  // check every position
+    }
+
     while (bp1 < end1) {
+        if (num_leads != 0) {  // skip ahead to a plausible first character
+            bp1 = Find_Byte_In_Set(bp1, end1, leads, num_leads);
+            if (not bp1)
+                break;
+        }
+
         const REBYTE *next1;
         REBUNI c1;
         if (*bp1 < 0x80) {
@@ -408,6 +709,59 @@ REBLEN Find_Str_In_Str(
     if (uncase)
         c2_canon = LO_CASE(c2_canon);
 
+    // Plain forward searches are done on the UTF-8 bytes, see Find_Bytes().
+    // The first position is tried even if it's past the /PART limit, as
+    // with the loop below.
+    //
+    if (skip == 1 and not (flags & AM_FIND_MATCH)) {
+        if (index + len > STR_LEN(str1))
+            return NOT_FOUND;
+
+        REBLEN tail = MIN(cast(REBLEN, MAX(index, end)) + len, STR_LEN(str1));
+        const REBYTE *bp1 = STR_AT(str1, index);
+        const REBYTE *ep1 = STR_AT(str1, tail);
+        const REBYTE *bp2 = STR_AT(str2, index2);
+
+        REBYTE leads[4];
+        REBLEN num_leads;
+
+        if (not uncase) {
+            const REBYTE *ep2 = STR_AT(str2, index2 + len);
+            REBSIZ size2 = ep2 - bp2;
+            const REBYTE *found = Find_Bytes(bp1, ep1, bp2, size2);
+            if (not found)
+                return NOT_FOUND;
+            return index + Count_Codepoints(bp1, found);
+        }
+
+        if (Get_Caseless_Lead_Bytes(leads, &num_leads, c2_canon)) {
+            const REBYTE *at = bp1;
+            while ((at = Find_Byte_In_Set(at, ep1, leads, num_leads))) {
+                REBCHR(const*) tp1 = cast(REBCHR(const*), at);
+                REBCHR(const*) tp2 = cast(REBCHR(const*), bp2);
+                REBLEN n;
+                for (n = 0; n < len; ++n) {
+                    if (not (tp1 < ep1))
+                        break;  // would run past the /PART limit
+
+                    REBUNI c1_at;
+                    REBUNI c2;
+                    tp1 = NEXT_CHR(&c1_at, tp1);
+                    tp2 = NEXT_CHR(&c2, tp2);
+                    if (c1_at != c2 and LO_CASE(c1_at) != LO_CASE(c2))
+                        break;
+                }
+                if (n == len)
+                    return index + Count_Codepoints(bp1, at);
+
+                ++at;  // lead bytes only match at codepoint boundaries
+            }
+            return NOT_FOUND;
+        }
+
+        // Non-ASCII first character searched caselessly, use the loop below
+    }
+
     // cp1 is the position in str1 that is our current tested head of a match
     //
     REBCHR(const*) cp1 = STR_AT(str1, index);
@@ -568,6 +922,69 @@ REBLEN Find_Char_In_Bin(
 }
 
 
+//
+//  Span_Bitset: C
+//
+// Count how many codepoints (or bytes, if `is_binary`) from `*bp_inout` are
+// in the bitset, stopping at `ep` or after `limit` of them.  The pointer is
+// updated to the first one not counted.  Runs of ASCII (or of any bytes in
+// a case-sensitive binary) are scanned by table, see Get_Byte_Class().
+//
+REBLEN Span_Bitset(
+    const REBYTE **bp_inout,
+    const REBYTE *ep,
+    REBLEN limit,
+    REBSER *bset,
+    bool uncase,
+    bool is_binary
+){
+    const bool high = is_binary and not uncase;
+    const bool span = true;
+    const struct Reb_Byte_Class *cls = Get_Byte_Class(
+        bset, uncase, high, span
+    );
+
+    const REBYTE *bp = *bp_inout;
+    REBLEN count = 0;
+    while (count < limit and bp != ep) {
+        //
+        // Bytes the table passes over are one codepoint each, so the run can
+        // be capped by the limit in bytes.
+        //
+        const REBYTE *run_end = ep;
+        if (cast(REBLEN, ep - bp) > limit - count)
+            run_end = bp + (limit - count);
+
+        const REBYTE *stop = Find_Stop_Byte(bp, run_end, cls);
+        count += stop - bp;
+        bp = stop;
+        if (bp == run_end)
+            continue;
+
+        if (*bp < 0x80 or high)
+            break;  // the table decided it's not in the set
+
+        REBUNI c;
+        const REBYTE *next;
+        if (is_binary) {
+            c = *bp;
+            next = bp + 1;
+        }
+        else
+            next = NEXT_CHR(&c, cast(REBCHR(const*), bp));
+
+        if (not Check_Bit(bset, c, uncase))
+            break;
+
+        ++count;
+        bp = next;
+    }
+
+    *bp_inout = bp;
+    return count;
+}
+
+
 //
 //  Find_Bin_Bitset: C
 //
@@ -592,6 +1009,21 @@ REBLEN Find_Bin_Bitset(
 
     assert((flags & ~AM_FIND_MATCH) == 0); // no AM_FIND_CASE
 
+    if (skip == 1 and not (flags & AM_FIND_MATCH)) {
+        const bool uncase = false;
+        const bool high = true;
+        const bool span = false;
+        const struct Reb_Byte_Class *cls = Get_Byte_Class(
+            bset, uncase, high, span
+        );
+        const REBYTE *bp = BIN_AT(bin, offset);
+        const REBYTE *ep = BIN_AT(bin, tail);
+        const REBYTE *stop = Find_Stop_Byte(bp, ep, cls);
+        if (stop == ep)
+            return NOT_FOUND;
+        return offset + (stop - bp);
+    }
+
     REBYTE *bp1 = BIN_AT(bin, offset);
 
     while (skip < 0 ? offset >= head : offset < tail) {
@@ -642,6 +1074,34 @@ REBLEN Find_Str_Bitset(
 
     bool uncase = not (flags & AM_FIND_CASE); // case insensitive
 
+    if (skip == 1 and not (flags & AM_FIND_MATCH)) {
+        //
+        // The table stops on ASCII members and on every non-ASCII byte, so
+        // what it passes over is one codepoint per byte.
+        //
+        const bool high = false;
+        const bool span = false;
+        const struct Reb_Byte_Class *cls = Get_Byte_Class(
+            bset, uncase, high, span
+        );
+        const REBYTE *bp = STR_AT(str, index);
+        const REBYTE *ep = STR_AT(str, end);
+        while (true) {
+            const REBYTE *stop = Find_Stop_Byte(bp, ep, cls);
+            index += stop - bp;
+            if (stop == ep)
+                return NOT_FOUND;
+            if (*stop < 0x80)
+                return index;
+
+            REBUNI c;
+            bp = NEXT_CHR(&c, cast(REBCHR(const*), stop));
+            if (Check_Bit(bset, c, uncase))
+                return index;
+            ++index;
+        }
+    }
+
     REBCHR(const*) cp1 = STR_AT(str, index);
     REBUNI c1;
     if (skip > 0)
@@ -770,6 +770,8 @@ REBTYPE(Binary)
       case SYM_INTERSECT:
       case SYM_UNION:
       case SYM_DIFFERENCE: {
+        Fail_If_Set_Operation_Into(frame_);
+
         REBVAL *arg = D_ARG(2);
 
         if (VAL_INDEX(v) > VAL_LEN_HEAD(v))
@@ -909,6 +911,9 @@ REBTYPE(Binary)
         if (REF(all))
             fail (Error_Bad_Refine_Raw(ARG(all)));
 
+        if (REF(key))
+            fail (Error_Bad_Refine_Raw(ARG(key)));
+
         if (REF(case)) {
             // Ignored...all BINARY! sorts are case-sensitive.
         }
@@ -665,6 +665,8 @@ REBTYPE(Bitset)
       case SYM_INTERSECT:
       case SYM_UNION:
       case SYM_DIFFERENCE: {
+        Fail_If_Set_Operation_Into(frame_);
+
         REBVAL *arg = D_ARG(2);
         if (IS_BITSET(arg)) {
             if (BITS_NOT(VAL_BITSET(arg)))  // !!! see #2365
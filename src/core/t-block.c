@@ -24,6 +24,12 @@
 
 #include "sys-core.h"
 
+#if defined(USE_PTHREADS) && !defined(__EMSCRIPTEN__)
+    #include <pthread.h>
+    #include <unistd.h>  // sysconf()
+    #define SORT_THREADED  // see Run_Radix_Parts()
+#endif
+
 
 //
 //  CT_Array: C
@@ -308,6 +314,361 @@ REB_R TO_Array(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg) {
 }
 
 
+//=//// FIND INDEX ////////////////////////////////////////////////////////=//
+//
+// FIND (and SELECT, and PARSE's TO and THRU) on a block is a linear scan.
+// Code that does `find keywords word` against the same big block over and
+// over pays for that scan every time.  So once an unmodified array has been
+// searched FIND_INDEX_AFTER times, a hash index of its positions is built
+// and later searches go through that.  This is transparent: the index is
+// only used for targets where it gives the same answer the scan would.
+//
+// Indexes are found by array pointer in a side table (the array's ->link
+// and ->misc hold its file and line), and an array that has an entry is
+// marked with ARRAY_FLAG_FIND_INDEXED.  Modifying the array (see
+// FAIL_IF_READ_ONLY_SER(), Expand_Series() and Remove_Series_Units()) or
+// freeing it (see Decay_Series()) calls Forget_Find_Index(), and counting
+// starts over.
+//
+// Only positions whose keys can't change without the array changing are
+// indexed: unquoted ANY-WORD!s (by canon, as FIND matches a word against any
+// word type), INTEGER!s, and ANY-STRING!s whose series are frozen.  Then:
+//
+// * WORD! targets can always use the index, since only words match them.
+//
+// * INTEGER! targets can't if the array has any DECIMAL! or PERCENT! (as
+//   Cmp_Value() calls those equal to integers within a tolerance).
+//
+// * ANY-STRING! targets can't if the array has any string that isn't frozen
+//   (as it could be changed to match without the array being modified).
+//
+// Neither of the last two can if the array has quoted values, as those are
+// equal to unquoted ones unless FIND/CASE.
+//
+
+#define FIND_INDEX_MIN_LEN 64  // shorter arrays are always scanned
+#define FIND_INDEX_AFTER 4  // finds on an unmodified array before indexing
+
+struct Reb_Find_Index {
+    struct Reb_Find_Index *next;  // in hash bucket (by array pointer)
+    REBARR *array;
+    REBLEN finds;  // since the array was last modified
+    REBLEN len;  // ARR_LEN() when built, paranoid check when used
+
+    bool has_quoted;
+    bool has_inexact;  // DECIMAL! or PERCENT!
+    bool has_mutable_string;
+
+    REBLEN num_heads;  // power of 2, or 0 if not built yet
+    REBLEN *heads;  // first position + 1 in each hash bucket (0 if none)
+    REBLEN *chain;  // next position + 1 in same bucket, ascending order
+    uint32_t *keys;  // key hash of each indexed position
+};
+
+static struct Reb_Find_Index **PG_Find_Index_Buckets;
+static REBLEN PG_Find_Index_Num_Buckets;
+static REBLEN PG_Find_Index_Num_Entries;
+
+#define FIND_INDEX_MIN_BUCKETS 64
+
+inline static REBLEN Find_Index_Bucket(REBARR *a, REBLEN num_buckets) {
+    uintptr_t p = cast(uintptr_t, a);
+    return ((p >> 4) ^ (p >> 12)) & (num_buckets - 1);  // power of 2
+}
+
+inline static bool Is_Find_Indexable_Array(REBARR *a) {
+    return not (SER(a)->header.bits & (
+        ARRAY_FLAG_IS_PARAMLIST | ARRAY_FLAG_IS_VARLIST
+            | ARRAY_FLAG_IS_PAIRLIST
+    ));
+}
+
+// Words are keyed by their canon (so the key doesn't depend on the kind of
+// word, or the case of its spelling), everything else by Hash_Value().
+//
+inline static uint32_t Find_Index_Key(const RELVAL *v) {
+    if (ANY_WORD(v)) {
+        uintptr_t p = cast(uintptr_t, VAL_WORD_CANON(v));
+        return Mix_Hash(cast(uint32_t, p >> 4));
+    }
+    return Mix_Hash(Hash_Value(v));
+}
+
+static void Free_Find_Index(struct Reb_Find_Index *fi) {
+    if (fi->num_heads != 0) {
+        FREE_N(REBLEN, fi->num_heads, fi->heads);
+        FREE_N(REBLEN, fi->len, fi->chain);
+        FREE_N(uint32_t, fi->len, fi->keys);
+    }
+    FREE(struct Reb_Find_Index, fi);
+    --PG_Find_Index_Num_Entries;
+}
+
+static void Expand_Find_Index_Buckets(void) {
+    REBLEN new_num = PG_Find_Index_Num_Buckets * 2;
+    struct Reb_Find_Index **new_buckets = ALLOC_N_ZEROFILL(
+        struct Reb_Find_Index*, new_num
+    );
+
+    REBLEN n;
+    for (n = 0; n < PG_Find_Index_Num_Buckets; ++n) {
+        struct Reb_Find_Index *fi = PG_Find_Index_Buckets[n];
+        while (fi) {
+            struct Reb_Find_Index *next = fi->next;
+            REBLEN b = Find_Index_Bucket(fi->array, new_num);
+            fi->next = new_buckets[b];
+            new_buckets[b] = fi;
+            fi = next;
+        }
+    }
+
+    FREE_N(
+        struct Reb_Find_Index*,
+        PG_Find_Index_Num_Buckets,
+        PG_Find_Index_Buckets
+    );
+    PG_Find_Index_Buckets = new_buckets;
+    PG_Find_Index_Num_Buckets = new_num;
+}
+
+
+// Build the index for an array that has been searched enough times.
+//
+static void Build_Find_Index(struct Reb_Find_Index *fi)
+{
+    REBARR *a = fi->array;
+    REBLEN len = ARR_LEN(a);
+
+    fi->len = len;
+    fi->has_quoted = false;
+    fi->has_inexact = false;
+    fi->has_mutable_string = false;
+
+    fi->num_heads = FIND_INDEX_MIN_BUCKETS;
+    while (fi->num_heads < len)
+        fi->num_heads *= 2;
+    fi->heads = ALLOC_N_ZEROFILL(REBLEN, fi->num_heads);
+    fi->chain = ALLOC_N(REBLEN, len);
+    fi->keys = ALLOC_N(uint32_t, len);
+
+    // Going from the tail to the head and linking each position in front of
+    // the last leaves each chain in ascending order, so the first match
+    // found is the one the scan would have found.
+    //
+    REBLEN pos = len;
+    while (pos != 0) {
+        --pos;
+        const RELVAL *item = ARR_AT(a, pos);
+        enum Reb_Kind kind = VAL_TYPE(item);
+
+        bool indexed;
+        if (kind == REB_QUOTED) {
+            fi->has_quoted = true;
+            indexed = false;
+        }
+        else if (ANY_WORD_KIND(kind) or kind == REB_INTEGER)
+            indexed = true;
+        else if (ANY_STRING_KIND(kind)) {
+            indexed = Is_Series_Frozen(VAL_SERIES(item));
+            if (not indexed)
+                fi->has_mutable_string = true;
+        }
+        else {
+            if (kind == REB_DECIMAL or kind == REB_PERCENT)
+                fi->has_inexact = true;
+            indexed = false;
+        }
+
+        if (not indexed) {
+            fi->chain[pos] = 0;
+            fi->keys[pos] = 0;
+            continue;
+        }
+
+        uint32_t key = Find_Index_Key(item);
+        REBLEN *head = &fi->heads[key & (fi->num_heads - 1)];
+        fi->keys[pos] = key;
+        fi->chain[pos] = *head;
+        *head = pos + 1;
+    }
+}
+
+
+//
+//  Try_Find_In_Array_Indexed: C
+//
+// Count a search of `array`, and if it has been searched enough times while
+// unmodified, answer it with the index.  Returns false if the search has to
+// be done by scanning instead, else puts the answer (which may be NOT_FOUND)
+// in `found`.
+//
+static bool Try_Find_In_Array_Indexed(
+    REBLEN *found,
+    REBARR *array,
+    REBLEN index,
+    REBLEN end,
+    const RELVAL *target,
+    REBFLGS flags,
+    REBLEN skip
+){
+    if (ARR_LEN(array) < FIND_INDEX_MIN_LEN)
+        return false;
+    if (not Is_Find_Indexable_Array(array))
+        return false;
+
+    enum Reb_Kind kind = VAL_TYPE(target);
+    if (
+        not ANY_WORD_KIND(kind) and kind != REB_INTEGER
+        and not ANY_STRING_KIND(kind)
+    ){
+        return false;  // would never be answered by the index
+    }
+
+    REBLEN b = Find_Index_Bucket(array, PG_Find_Index_Num_Buckets);
+    struct Reb_Find_Index *fi = PG_Find_Index_Buckets[b];
+    for (; fi; fi = fi->next) {
+        if (fi->array == array)
+            break;
+    }
+
+    if (not fi) {
+        fi = ALLOC(struct Reb_Find_Index);
+        fi->array = array;
+        fi->finds = 0;
+        fi->num_heads = 0;
+        fi->next = PG_Find_Index_Buckets[b];
+        PG_Find_Index_Buckets[b] = fi;
+        SET_ARRAY_FLAG(array, FIND_INDEXED);
+
+        if (++PG_Find_Index_Num_Entries > PG_Find_Index_Num_Buckets * 2)
+            Expand_Find_Index_Buckets();
+    }
+
+    if (fi->num_heads == 0) {
+        if (++fi->finds < FIND_INDEX_AFTER)
+            return false;
+        Build_Find_Index(fi);
+    }
+
+    assert(fi->len == ARR_LEN(array));  // modification should have forgotten
+
+    if (ANY_WORD_KIND(kind)) {
+        // always usable
+    }
+    else if (fi->has_quoted)
+        return false;
+    else if (kind == REB_INTEGER) {
+        if (fi->has_inexact)
+            return false;
+    }
+    else if (fi->has_mutable_string)
+        return false;
+
+    uint32_t key = Find_Index_Key(target);
+    REBLEN n = fi->heads[key & (fi->num_heads - 1)];
+    for (; n != 0; n = fi->chain[n - 1]) {
+        REBLEN pos = n - 1;
+        if (pos >= end)
+            break;  // ascending, so nothing later is in range either
+        if (pos < index or fi->keys[pos] != key)
+            continue;
+        if ((pos - index) % skip != 0)
+            continue;
+
+        const RELVAL *item = ARR_AT(array, pos);
+        if (ANY_WORD_KIND(kind)) {  // same tests as in Find_In_Array()
+            if (flags & AM_FIND_CASE) {
+                if (
+                    VAL_WORD_SPELLING(item) != VAL_WORD_SPELLING(target)
+                    or VAL_TYPE(item) != kind
+                ){
+                    continue;
+                }
+            }
+            else if (VAL_WORD_CANON(item) != VAL_WORD_CANON(target))
+                continue;
+        }
+        else if (0 != Cmp_Value(item, target, did (flags & AM_FIND_CASE)))
+            continue;
+
+        *found = pos;
+        return true;
+    }
+
+    *found = NOT_FOUND;
+    return true;
+}
+
+
+//
+//  Forget_Find_Index: C
+//
+// Free the FIND index (or count of finds) for an array, because it is about
+// to be modified or is going away.
+//
+void Forget_Find_Index(REBARR *a)
+{
+    CLEAR_ARRAY_FLAG(a, FIND_INDEXED);
+
+    if (not PG_Find_Index_Buckets)
+        return;  // before Startup_Find_Index() or after Shutdown_Find_Index()
+
+    struct Reb_Find_Index **link = &PG_Find_Index_Buckets[
+        Find_Index_Bucket(a, PG_Find_Index_Num_Buckets)
+    ];
+    while (*link) {
+        struct Reb_Find_Index *fi = *link;
+        if (fi->array == a) {
+            *link = fi->next;
+            Free_Find_Index(fi);
+            return;  // only one per array
+        }
+        link = &fi->next;
+    }
+}
+
+
+//
+//  Startup_Find_Index: C
+//
+void Startup_Find_Index(void)
+{
+    PG_Find_Index_Num_Buckets = FIND_INDEX_MIN_BUCKETS;
+    PG_Find_Index_Buckets = ALLOC_N_ZEROFILL(
+        struct Reb_Find_Index*, PG_Find_Index_Num_Buckets
+    );
+    PG_Find_Index_Num_Entries = 0;
+}
+
+
+//
+//  Shutdown_Find_Index: C
+//
+// The shutdown recycle has decayed all the arrays, so there should not be
+// any indexes left (unless an unmanaged array was leaked).
+//
+void Shutdown_Find_Index(void)
+{
+    REBLEN n;
+    for (n = 0; n < PG_Find_Index_Num_Buckets; ++n) {
+        while (PG_Find_Index_Buckets[n]) {
+            struct Reb_Find_Index *fi = PG_Find_Index_Buckets[n];
+            PG_Find_Index_Buckets[n] = fi->next;
+            Free_Find_Index(fi);
+        }
+    }
+    assert(PG_Find_Index_Num_Entries == 0);
+
+    FREE_N(
+        struct Reb_Find_Index*,
+        PG_Find_Index_Num_Buckets,
+        PG_Find_Index_Buckets
+    );
+    PG_Find_Index_Buckets = nullptr;
+    PG_Find_Index_Num_Buckets = 0;
+}
+
+
 //
 //  Find_In_Array: C
 //
@@ -334,6 +695,15 @@ REBLEN Find_In_Array(
     else
         start = index;
 
+    if (skip > 0 and not (flags & AM_FIND_MATCH) and index < end) {
+        REBLEN found;
+        if (Try_Find_In_Array_Indexed(
+            &found, array, index, end, target, flags, skip
+        )){
+            return found;
+        }
+    }
+
     // Optimized find word in block
     //
     if (ANY_WORD(target)) {
@@ -433,55 +803,60 @@ REBLEN Find_In_Array(
 }
 
 
-struct sort_flags {
+// SORT on arrays is a stable merge sort.  Rather than shuffle REBVAL-sized
+// records around while comparing, it sorts a vector of record numbers and
+// then permutes the records into place in a single pass at the end.  This
+// means a comparator which fails or throws leaves the block unmodified, and
+// means /KEY can compare against a separate vector of extracted keys.
+//
+// When every key is an unquoted INTEGER!, DECIMAL!, TEXT! or WORD! the
+// comparison skips the type dispatch in Cmp_Value() and calls the routine
+// for that type directly.
+//
+enum Reb_Sort_Mode {
+    SORT_MODE_VALUE,  // generic Cmp_Value()
+    SORT_MODE_INTEGER,
+    SORT_MODE_DECIMAL,
+    SORT_MODE_TEXT,
+    SORT_MODE_WORD,
+    SORT_MODE_CUSTOM  // ACTION! passed to /COMPARE
+};
+
+struct Reb_Sorter {
+    enum Reb_Sort_Mode mode;
     bool cased;
     bool reverse;
-    REBLEN offset;
+    const RELVAL *keys;  // key of record 0
+    REBLEN stride;  // cells between the keys of adjacent records
     REBVAL *comparator;
-    bool all; // !!! not used?
 };
 
-
+// Runs shorter than this are put in order with an insertion sort before the
+// merge passes begin.
 //
-//  Compare_Val: C
-//
-static int Compare_Val(void *arg, const void *v1, const void *v2)
-{
-    struct sort_flags *flags = cast(struct sort_flags*, arg);
-
-    // !!!! BE SURE that 64 bit large difference comparisons work
-
-    if (flags->reverse)
-        return Cmp_Value(
-            cast(const RELVAL*, v2) + flags->offset,
-            cast(const RELVAL*, v1) + flags->offset,
-            flags->cased
-        );
-    else
-        return Cmp_Value(
-            cast(const RELVAL*, v1) + flags->offset,
-            cast(const RELVAL*, v2) + flags->offset,
-            flags->cased
-        );
-}
+#define SORT_RUN_LEN 16
 
 
 //
 //  Compare_Val_Custom: C
 //
-static int Compare_Val_Custom(void *arg, const void *v1, const void *v2)
-{
-    struct sort_flags *flags = cast(struct sort_flags*, arg);
-
+// The comparator is called with the arguments in the order (v2, v1), which
+// is what historical SORT/COMPARE did.
+//
+static int Compare_Val_Custom(
+    REBVAL *comparator,
+    const RELVAL *v1,
+    const RELVAL *v2
+){
     const bool fully = true; // error if not all arguments consumed
 
     DECLARE_LOCAL (result);
     if (RunQ_Throws(
         result,
         fully,
-        rebU1(flags->comparator),
-        flags->reverse ? v1 : v2,
-        flags->reverse ? v2 : v1,
+        rebU1(comparator),
+        v2,
+        v1,
         rebEND
     )) {
         fail (Error_No_Catch_For_Throw(result));
@@ -512,6 +887,382 @@ static int Compare_Val_Custom(void *arg, const void *v1, const void *v2)
 }
 
 
+//
+//  Compare_Records: C
+//
+// Compare the keys of records `i` and `j`.  Ties must return 0 (or less) so
+// the merge keeps the earlier record first, which is what makes it stable.
+//
+static REBINT Compare_Records(struct Reb_Sorter *s, REBLEN i, REBLEN j)
+{
+    if (s->reverse) {
+        REBLEN temp = i;
+        i = j;
+        j = temp;
+    }
+
+    const RELVAL *a = s->keys + (i * s->stride);
+    const RELVAL *b = s->keys + (j * s->stride);
+
+    switch (s->mode) {
+      case SORT_MODE_INTEGER:
+        return (VAL_INT64(a) > VAL_INT64(b)) - (VAL_INT64(a) < VAL_INT64(b));
+
+      case SORT_MODE_DECIMAL:  // exactly, as Radix_Sort_Records() does
+        return (VAL_DECIMAL(a) > VAL_DECIMAL(b))
+            - (VAL_DECIMAL(a) < VAL_DECIMAL(b));
+
+      case SORT_MODE_TEXT:
+        return Compare_String_Vals(a, b, not s->cased);
+
+      case SORT_MODE_WORD:
+        if (VAL_WORD_SPELLING(a) == VAL_WORD_SPELLING(b))
+            return 0;  // interned, so same spelling is the same pointer
+        return Compare_Word(a, b, s->cased);
+
+      case SORT_MODE_CUSTOM:
+        return Compare_Val_Custom(s->comparator, a, b);
+
+      default:
+        assert(s->mode == SORT_MODE_VALUE);
+        return Cmp_Value(a, b, s->cased);
+    }
+}
+
+
+//
+//  Merge_Sort_Records: C
+//
+// Stable bottom-up merge sort of the record numbers in `order`, using `temp`
+// (of the same length) as the other half of a ping-pong buffer.
+//
+static void Merge_Sort_Records(
+    struct Reb_Sorter *s,
+    REBLEN *order,
+    REBLEN *temp,
+    REBLEN n
+){
+    REBLEN lo;
+    for (lo = 0; lo < n; lo += SORT_RUN_LEN) {
+        REBLEN hi = MIN(lo + SORT_RUN_LEN, n);
+        REBLEN i;
+        for (i = lo + 1; i < hi; ++i) {
+            REBLEN rec = order[i];
+            REBLEN j = i;
+            for (; j > lo and Compare_Records(s, order[j - 1], rec) > 0; --j)
+                order[j] = order[j - 1];
+            order[j] = rec;
+        }
+    }
+
+    REBLEN *src = order;
+    REBLEN *dest = temp;
+
+    REBLEN width;
+    for (width = SORT_RUN_LEN; width < n; width *= 2) {
+        for (lo = 0; lo < n; lo += 2 * width) {
+            REBLEN mid = MIN(lo + width, n);
+            REBLEN hi = MIN(lo + 2 * width, n);
+
+            // Runs that are already in order relative to each other (as in
+            // presorted or appended-to-sorted input) need no merging.
+            //
+            if (mid == hi or Compare_Records(s, src[mid - 1], src[mid]) <= 0) {
+                memcpy(dest + lo, src + lo, sizeof(REBLEN) * (hi - lo));
+                continue;
+            }
+
+            REBLEN a = lo;
+            REBLEN b = mid;
+            REBLEN out = lo;
+            while (a < mid and b < hi) {
+                if (Compare_Records(s, src[a], src[b]) <= 0)
+                    dest[out++] = src[a++];
+                else
+                    dest[out++] = src[b++];
+            }
+            while (a < mid)
+                dest[out++] = src[a++];
+            while (b < hi)
+                dest[out++] = src[b++];
+        }
+
+        REBLEN *swap = src;
+        src = dest;
+        dest = swap;
+    }
+
+    if (src != order)
+        memcpy(order, src, sizeof(REBLEN) * n);
+}
+
+
+// Large all-INTEGER! or all-DECIMAL! sorts with no comparator don't need
+// to look at cells while sorting.  Each key is turned into an unsigned 64
+// bit integer that orders the same way the number does, and those are put
+// in order with a least-significant-byte-first radix sort.  Each pass is a
+// stable counting sort, so records with equal keys stay in order.
+//
+// DECIMAL! keys are compared exactly (with -0.0 the same as 0.0), and so
+// are they in Compare_Records().  Using Eq_Decimal() there would make values
+// within 10 ULPs keep their original order in small blocks but not in ones
+// big enough for the radix sort--and it isn't transitive anyway.
+//
+struct Reb_Sort_Key {
+    uint64_t bits;
+    REBLEN rec;
+};
+
+// Below this many records the merge sort wins over the fixed cost of the
+// radix histograms.
+//
+#define SORT_RADIX_MIN 1024
+
+// The records are divided into parts, which are run on threads in builds
+// that have them (see SORT_THREADED).  A part makes the keys of its records
+// and counts their bytes.  Then in each pass it moves its keys to where the
+// counts of all the parts say they go.  The parts are laid out in order for
+// each byte value, so the sort is stable and gives the same result for any
+// number of threads.  It's safe to read the key cells off the main thread,
+// since nothing is evaluated or allocated while the threads run.
+//
+#define SORT_MAX_THREADS 8
+#define SORT_THREAD_MIN (64 * 1024)  // records a thread needs to be worth it
+
+enum Reb_Radix_Phase {
+    RADIX_PHASE_KEYS,  // make keys for the part's records, count all bytes
+    RADIX_PHASE_COUNT,  // count one byte of the part's keys in `src`
+    RADIX_PHASE_MOVE  // move the part's keys from `src` to `dest`
+};
+
+struct Reb_Radix_Part {
+    struct Reb_Sorter *s;
+    enum Reb_Radix_Phase phase;
+    struct Reb_Sort_Key *src;
+    struct Reb_Sort_Key *dest;
+    REBLEN lo;  // first key position of the part
+    REBLEN hi;  // ...and one past its last
+    int byte;  // which byte a COUNT or MOVE is for
+    REBLEN counts[8][256];  // made into positions in `dest` before a MOVE
+};
+
+
+inline static uint64_t Radix_Key_Bits(struct Reb_Sorter *s, REBLEN rec)
+{
+    const uint64_t sign = cast(uint64_t, 1) << 63;
+    const RELVAL *key = s->keys + (rec * s->stride);
+
+    uint64_t bits;
+    if (s->mode == SORT_MODE_INTEGER)
+        bits = cast(uint64_t, VAL_INT64(key)) ^ sign;
+    else {
+        REBDEC d = VAL_DECIMAL(key);
+        if (d == 0.0)
+            d = 0.0;  // make -0.0 the same as 0.0
+        memcpy(&bits, &d, sizeof(bits));
+        if (bits & sign)
+            bits = ~bits;  // negatives: larger magnitude sorts first
+        else
+            bits |= sign;
+    }
+    if (s->reverse)
+        bits = ~bits;
+    return bits;
+}
+
+
+static void Run_Radix_Part(struct Reb_Radix_Part *p)
+{
+    REBLEN i;
+    switch (p->phase) {
+      case RADIX_PHASE_KEYS:
+        memset(p->counts, 0, sizeof(p->counts));
+        for (i = p->lo; i < p->hi; ++i) {
+            uint64_t bits = Radix_Key_Bits(p->s, i);
+            p->src[i].bits = bits;
+            p->src[i].rec = i;
+
+            int byte;
+            for (byte = 0; byte < 8; ++byte)
+                ++p->counts[byte][(bits >> (byte * 8)) & 0xFF];
+        }
+        break;
+
+      case RADIX_PHASE_COUNT: {
+        REBLEN *count = p->counts[p->byte];
+        int shift = p->byte * 8;
+        memset(count, 0, sizeof(REBLEN) * 256);
+        for (i = p->lo; i < p->hi; ++i)
+            ++count[(p->src[i].bits >> shift) & 0xFF];
+        break; }
+
+      case RADIX_PHASE_MOVE: {
+        REBLEN *count = p->counts[p->byte];
+        int shift = p->byte * 8;
+        for (i = p->lo; i < p->hi; ++i)
+            p->dest[count[(p->src[i].bits >> shift) & 0xFF]++] = p->src[i];
+        break; }
+    }
+}
+
+
+#ifdef SORT_THREADED
+
+static void *Radix_Part_Thread(void *p)
+{
+    Run_Radix_Part(cast(struct Reb_Radix_Part*, p));
+    return nullptr;
+}
+
+#endif
+
+
+// Run the current phase of all the parts, and wait for them to finish.  The
+// first part runs on the calling thread, as does any part that a thread
+// couldn't be started for.
+//
+static void Run_Radix_Parts(struct Reb_Radix_Part *parts, REBLEN num_parts)
+{
+    REBLEN t;
+
+  #ifdef SORT_THREADED
+    pthread_t threads[SORT_MAX_THREADS];
+    bool started[SORT_MAX_THREADS];
+    for (t = 1; t < num_parts; ++t)
+        started[t] = (0 == pthread_create(
+            &threads[t], nullptr, &Radix_Part_Thread, &parts[t]
+        ));
+
+    Run_Radix_Part(&parts[0]);
+
+    for (t = 1; t < num_parts; ++t) {
+        if (started[t])
+            pthread_join(threads[t], nullptr);
+        else
+            Run_Radix_Part(&parts[t]);
+    }
+  #else
+    for (t = 0; t < num_parts; ++t)
+        Run_Radix_Part(&parts[t]);
+  #endif
+}
+
+
+// How many parts to divide `n` records into.  The R3_SORT_THREADS variable
+// in the environment can lower the number of threads (e.g. to measure how
+// the sort scales), it's otherwise the number of CPUs online.  Without
+// threads (as in Emscripten builds), there is just one part.
+//
+static REBLEN Radix_Sort_Parts(REBLEN n)
+{
+  #ifdef SORT_THREADED
+    REBLEN limit = SORT_MAX_THREADS;
+
+    const char *env_sort_threads = getenv("R3_SORT_THREADS");
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (env_sort_threads and atoi(env_sort_threads) > 0)
+        limit = MIN(limit, cast(REBLEN, atoi(env_sort_threads)));
+    else if (cpus > 0)
+        limit = MIN(limit, cast(REBLEN, cpus));
+    else
+        limit = 1;
+
+    REBLEN parts = n / SORT_THREAD_MIN;
+    if (parts == 0)
+        return 1;
+    return MIN(parts, limit);
+  #else
+    UNUSED(n);
+    return 1;
+  #endif
+}
+
+
+//
+//  Radix_Sort_Records: C
+//
+// Fill `order` with the record numbers in sorted order.  `buf` must have
+// room for 2 * n keys, used as a ping-pong buffer between passes.
+//
+static void Radix_Sort_Records(
+    struct Reb_Sorter *s,
+    REBLEN *order,
+    struct Reb_Sort_Key *buf,
+    REBLEN n
+){
+    assert(s->mode == SORT_MODE_INTEGER or s->mode == SORT_MODE_DECIMAL);
+
+    struct Reb_Sort_Key *src = buf;
+    struct Reb_Sort_Key *dest = buf + n;
+
+    // No fail() can happen while the parts are allocated.
+    //
+    REBLEN num_parts = Radix_Sort_Parts(n);
+    struct Reb_Radix_Part *parts = ALLOC_N(struct Reb_Radix_Part, num_parts);
+
+    REBLEN t;
+    for (t = 0; t < num_parts; ++t) {
+        parts[t].s = s;
+        parts[t].phase = RADIX_PHASE_KEYS;
+        parts[t].src = src;
+        parts[t].lo = cast(REBLEN, cast(uint64_t, n) * t / num_parts);
+        parts[t].hi = cast(REBLEN, cast(uint64_t, n) * (t + 1) / num_parts);
+    }
+    Run_Radix_Parts(parts, num_parts);
+
+    bool moved = false;  // parts' counts are stale after a move (if > 1)
+
+    int byte;
+    for (byte = 0; byte < 8; ++byte) {
+        int shift = byte * 8;
+        REBLEN digit_first = (src[0].bits >> shift) & 0xFF;
+
+        REBLEN same = 0;  // how many keys share the first key's byte here
+        for (t = 0; t < num_parts; ++t)
+            same += parts[t].counts[byte][digit_first];
+        if (same == n)
+            continue;  // all keys have the same byte here, e.g. small ints
+
+        for (t = 0; t < num_parts; ++t) {
+            parts[t].byte = byte;
+            parts[t].src = src;
+            parts[t].dest = dest;
+        }
+
+        if (moved and num_parts > 1) {
+            for (t = 0; t < num_parts; ++t)
+                parts[t].phase = RADIX_PHASE_COUNT;
+            Run_Radix_Parts(parts, num_parts);
+        }
+
+        REBLEN pos = 0;
+        int digit;
+        for (digit = 0; digit < 256; ++digit) {
+            for (t = 0; t < num_parts; ++t) {
+                REBLEN c = parts[t].counts[byte][digit];
+                parts[t].counts[byte][digit] = pos;
+                pos += c;
+            }
+        }
+
+        for (t = 0; t < num_parts; ++t)
+            parts[t].phase = RADIX_PHASE_MOVE;
+        Run_Radix_Parts(parts, num_parts);
+        moved = true;
+
+        struct Reb_Sort_Key *swap = src;
+        src = dest;
+        dest = swap;
+    }
+
+    FREE_N(struct Reb_Radix_Part, num_parts, parts);
+
+    REBLEN i;
+    for (i = 0; i < n; ++i)
+        order[i] = src[i].rec;
+}
+
+
 //
 //  Sort_Block: C
 //
@@ -525,6 +1276,8 @@ static int Compare_Val_Custom(void *arg, const void *v1, const void *v2)
 // limit [any-number! any-series!] {Length of series to sort}
 // /all {Compare all fields}
 // /reverse {Reverse sort order}
+// /key {Function run once per record, whose results are compared}
+// extractor [action!]
 //
 static void Sort_Block(
     REBVAL *block,
@@ -533,26 +1286,26 @@ static void Sort_Block(
     REBVAL *compv,
     REBVAL *part,
     bool all,
-    bool rev
+    bool rev,
+    REBVAL *keyv
 ) {
-    struct sort_flags flags;
-    flags.cased = ccase;
-    flags.reverse = rev;
-    flags.all = all; // !!! not used?
+    UNUSED(all);  // !!! not used?
 
+    struct Reb_Sorter s;
+    s.cased = ccase;
+    s.reverse = rev;
+    s.comparator = nullptr;
+
+    REBLEN offset = 0;
     if (IS_ACTION(compv)) {
-        flags.comparator = compv;
-        flags.offset = 0;
-    }
-    else if (IS_INTEGER(compv)) {
-        flags.comparator = NULL;
-        flags.offset = Int32(compv) - 1;
+        if (not IS_NULLED(keyv))
+            fail (Error_Bad_Refines_Raw());  // /KEY and /COMPARE :ACTION
+        s.comparator = compv;
     }
-    else {
+    else if (IS_INTEGER(compv))
+        offset = Int32(compv) - 1;
+    else
         assert(IS_NULLED(compv));
-        flags.comparator = NULL;
-        flags.offset = 0;
-    }
 
     REBLEN len = Part_Len_May_Modify_Index(block, part); // length of sort
     if (len <= 1)
@@ -568,13 +1321,122 @@ static void Sort_Block(
     else
         skip = 1;
 
-    reb_qsort_r(
-        VAL_ARRAY_AT(block),
-        len / skip,
-        sizeof(REBVAL) * skip,
-        &flags,
-        flags.comparator != NULL ? &Compare_Val_Custom : &Compare_Val
+    if (offset >= skip)
+        fail (Error_Out_Of_Range(compv));
+
+    REBLEN n = len / skip;
+
+    REBDSP dsp_orig = DSP;
+
+    if (not IS_NULLED(keyv)) {
+        //
+        // Schwartzian transform: the extractor runs once per record (on
+        // the field the comparison would otherwise look at), and the sort
+        // compares those results.  They live on the data stack so the GC
+        // sees them, and are only addressed once all have been pushed
+        // since pushing can relocate the stack.
+        //
+        const bool fully = true;
+        DECLARE_LOCAL (result);
+        REBLEN i;
+        for (i = 0; i < n; ++i) {
+            if (RunQ_Throws(
+                result,
+                fully,
+                rebU1(keyv),
+                VAL_ARRAY_AT(block) + (i * skip) + offset,
+                rebEND
+            )){
+                fail (Error_No_Catch_For_Throw(result));
+            }
+            Move_Value(DS_PUSH(), result);
+        }
+        s.keys = DS_AT(dsp_orig + 1);
+        s.stride = 1;
+    }
+    else {
+        s.keys = VAL_ARRAY_AT(block) + offset;
+        s.stride = skip;
+    }
+
+    if (s.comparator)
+        s.mode = SORT_MODE_CUSTOM;
+    else {
+        const RELVAL *first = s.keys;
+        enum Reb_Kind kind = VAL_TYPE(first);
+        switch (kind) {
+          case REB_INTEGER: s.mode = SORT_MODE_INTEGER; break;
+          case REB_DECIMAL: s.mode = SORT_MODE_DECIMAL; break;
+          case REB_TEXT: s.mode = SORT_MODE_TEXT; break;
+          case REB_WORD: s.mode = SORT_MODE_WORD; break;
+          default: s.mode = SORT_MODE_VALUE; break;
+        }
+
+        REBLEN i;
+        for (i = 1; i < n and s.mode != SORT_MODE_VALUE; ++i) {
+            if (VAL_TYPE(s.keys + (i * s.stride)) != kind)
+                s.mode = SORT_MODE_VALUE;  // VAL_TYPE() is REB_QUOTED if so
+        }
+    }
+
+    bool radix = (
+        (s.mode == SORT_MODE_INTEGER or s.mode == SORT_MODE_DECIMAL)
+        and n >= SORT_RADIX_MIN
+    );
+
+    // One scratch allocation holds a raw copy of the records for the final
+    // permutation, followed by the record order and the buffer the sort
+    // needs alongside it.  It is not an array (the GC doesn't look inside
+    // it), and no evaluation can happen while it holds copies of cells.
+    // Unmanaged series are freed automatically if a comparator fails.
+    //
+    size_t work_size = radix
+        ? 2 * n * sizeof(struct Reb_Sort_Key) + n * sizeof(REBLEN)
+        : 2 * n * sizeof(REBLEN);
+    REBLEN work_cells = (work_size + sizeof(REBVAL) - 1) / sizeof(REBVAL);
+
+    REBSER *scratch = Make_Series_Core(
+        len + work_cells,
+        sizeof(REBVAL),
+        SERIES_FLAG_ALWAYS_DYNAMIC
     );
+    RELVAL *records = SER_HEAD(RELVAL, scratch);
+
+    REBLEN *order;
+    REBLEN i;
+    if (radix) {
+        struct Reb_Sort_Key *buf = cast(struct Reb_Sort_Key*, records + len);
+        order = cast(REBLEN*, buf + 2 * n);
+        Radix_Sort_Records(&s, order, buf, n);
+    }
+    else {
+        order = cast(REBLEN*, records + len);
+        for (i = 0; i < n; ++i)
+            order[i] = i;
+        Merge_Sort_Records(&s, order, order + n, n);
+    }
+
+    DS_DROP_TO(dsp_orig);
+
+    // Rare case where RELVAL bit copying is okay...between spots in the
+    // same array (by way of a raw buffer).  NEWLINE_BEFORE moves with the
+    // record, as it did when records were swapped by the old qsort.
+    //
+    // FAIL_IF_READ_ONLY() was before the /COMPARE or /KEY function ran, and
+    // a FIND in it could have indexed the array at the old positions.
+    //
+    Forget_Find_Index_If_Any(SER(VAL_ARRAY(block)));
+
+    RELVAL *at = VAL_ARRAY_AT(block);
+    memcpy(cast(void*, records), at, sizeof(RELVAL) * len);
+    for (i = 0; i < n; ++i)
+        memcpy(
+            cast(void*, at + (i * skip)),
+            records + (order[i] * skip),
+            sizeof(RELVAL) * skip
+        );
+
+    Free_Unmanaged_Series(scratch);
 }
 
 
@@ -1135,7 +1997,8 @@ REBTYPE(Array)
             ARG(compare),  // blank! if no /COMPARE
             ARG(part),  // blank! if no /PART
             did REF(all),
-            did REF(reverse)
+            did REF(reverse),
+            ARG(key)  // null if no /KEY
         );
         RETURN (array); }
 
@@ -279,16 +279,19 @@ REBTYPE(Char)
         break;
 
     case SYM_INTERSECT:
+        Fail_If_Set_Operation_Into(frame_);
         arg = Math_Arg_For_Char(D_ARG(2), verb);
         chr &= cast(REBUNI, arg);
         break;
 
     case SYM_UNION:
+        Fail_If_Set_Operation_Into(frame_);
         arg = Math_Arg_For_Char(D_ARG(2), verb);
         chr |= cast(REBUNI, arg);
         break;
 
     case SYM_DIFFERENCE:
+        Fail_If_Set_Operation_Into(frame_);
         arg = Math_Arg_For_Char(D_ARG(2), verb);
         chr ^= cast(REBUNI, arg);
         break;
@@ -1007,6 +1007,9 @@ REBTYPE(Date)
             if (REF(skip))
                 fail (Error_Bad_Refines_Raw());
 
+            if (REF(into))
+                fail (Error_Bad_Refine_Raw(ARG(into)));
+
             // !!! Plain SUBTRACT on dates has historically given INTEGER! of
             // days, while DIFFERENCE has given back a TIME!.  This is not
             // consistent with the "symmetric difference" that all other
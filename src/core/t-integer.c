@@ -262,6 +262,9 @@ REBTYPE(Integer)
 
     REBSYM sym = VAL_WORD_SYM(verb);
 
+    if (sym == SYM_INTERSECT or sym == SYM_UNION or sym == SYM_DIFFERENCE)
+        Fail_If_Set_Operation_Into(frame_);  // bitwise, no series result
+
     // !!! This used to rely on IS_BINARY_ACT, which is no longer available
     // in the symbol based dispatch.  Consider doing another way.
     //
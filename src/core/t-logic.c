@@ -438,14 +438,17 @@ REBTYPE(Logic)
     switch (VAL_WORD_SYM(verb)) {
 
     case SYM_INTERSECT:
+        Fail_If_Set_Operation_Into(frame_);
         b2 = Math_Arg_For_Logic(D_ARG(2));
         return Init_Logic(D_OUT, b1 and b2);
 
     case SYM_UNION:
+        Fail_If_Set_Operation_Into(frame_);
         b2 = Math_Arg_For_Logic(D_ARG(2));
         return Init_Logic(D_OUT, b1 or b2);
 
     case SYM_DIFFERENCE:
+        Fail_If_Set_Operation_Into(frame_);
         b2 = Math_Arg_For_Logic(D_ARG(2));
         return Init_Logic(D_OUT, b1 != b2);
 
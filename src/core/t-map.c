@@ -25,6 +25,14 @@
 //
 
 #include "sys-core.h"
+#include "sys-simd.h"
+
+#if defined(REB_SSE2)
+    #define HASH_PROBE_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define HASH_PROBE_NEON
+#endif
 
 //
 //  CT_Map: C
@@ -65,180 +73,351 @@ static REBCTX *Error_Conflicting_Key(const RELVAL *key, REBSPC *specifier)
 }
 
 
+//=//// CONTROL BYTE GROUP MATCHING ///////////////////////////////////////=//
 //
-//  Find_Key_Hashed: C
+// These give back a bitmask with a bit set for each control byte in a group
+// that matches.  SSE2 and the portable fallback give one bit per byte, while
+// NEON (which has no "movemask") gives one bit per nibble--so the bit number
+// is shifted by HASH_MASK_SHIFT to get the position in the group.
 //
-// Returns hash index (either the match or the new one).
-// A return of zero is valid (as a hash index);
+// "Free" means EMPTY or DELETED, which are the only control bytes with the
+// high bit set (fingerprints are 7 bits).
 //
-// Wide: width of record (normally 2, a key and a value).
+
+#if defined(HASH_PROBE_NEON)
+    #define HASH_MASK_SHIFT 2
+
+    inline static uint64_t Neon_Match_Mask(uint8x16_t cmp) {
+        uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(cmp), 4);
+        return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0)
+            & 0x8888888888888888ULL;  // one bit per nibble
+    }
+
+    inline static uint64_t Match_Group(const REBYTE *group, REBYTE b)
+      { return Neon_Match_Mask(vceqq_u8(vld1q_u8(group), vdupq_n_u8(b))); }
+
+    inline static uint64_t Match_Group_Free(const REBYTE *group) {
+        int8x16_t g = vreinterpretq_s8_u8(vld1q_u8(group));
+        return Neon_Match_Mask(vreinterpretq_u8_s8(vshrq_n_s8(g, 7)));
+    }
+
+#elif defined(HASH_PROBE_SSE2)
+    #define HASH_MASK_SHIFT 0
+
+    inline static uint64_t Match_Group(const REBYTE *group, REBYTE b) {
+        __m128i g = _mm_loadu_si128(cast(const __m128i*, group));
+        __m128i eq = _mm_cmpeq_epi8(g, _mm_set1_epi8(cast(char, b)));
+        return cast(uint16_t, _mm_movemask_epi8(eq));
+    }
+
+    inline static uint64_t Match_Group_Free(const REBYTE *group) {
+        __m128i g = _mm_loadu_si128(cast(const __m128i*, group));
+        return cast(uint16_t, _mm_movemask_epi8(g));  // high bits
+    }
+
+#else
+    #define HASH_MASK_SHIFT 0
+
+    inline static uint64_t Match_Group(const REBYTE *group, REBYTE b) {
+        uint64_t mask = 0;
+        REBLEN i;
+        for (i = 0; i < HASH_GROUP_WIDTH; ++i) {
+            if (group[i] == b)
+                mask |= cast(uint64_t, 1) << i;
+        }
+        return mask;
+    }
+
+    inline static uint64_t Match_Group_Free(const REBYTE *group) {
+        uint64_t mask = 0;
+        REBLEN i;
+        for (i = 0; i < HASH_GROUP_WIDTH; ++i) {
+            if (group[i] & 0x80)
+                mask |= cast(uint64_t, 1) << i;
+        }
+        return mask;
+    }
+#endif
+
+inline static REBLEN Lowest_Match(uint64_t mask)
+  { return Lowest_Set_Bit(mask) >> HASH_MASK_SHIFT; }
+
+
 //
-// Modes:
-//     0 - search, return hash if found or not
-//     1 - search, return hash, else return -1 if not
-//     2 - search, return hash, else append value and return -1
+//  Find_Hashed: C
 //
-REBINT Find_Key_Hashed(
+// Look up a key whose hash (as mixed by Mix_Hash()) is already known, and
+// return the slot in the hashlist that refers to its record--or -1 if the
+// key is not present.
+//
+// Wide: width of record (normally 2, a key and a value).
+//
+REBINT Find_Hashed(
     REBARR *array,
     REBSER *hashlist,
-    const RELVAL *key, // !!! assumes key is followed by value(s) via ++
+    const RELVAL *key,  // !!! assumes key is followed by value(s) via ++
     REBSPC *specifier,
     REBLEN wide,
     bool cased,
-    REBYTE mode
+    uint32_t hash
 ){
-    // Hashlists store a indexes into the actual data array, of where the
-    // first key corresponding to that hash is.  There may be more keys
-    // indicated by that hash, vying for the same slot.  So the collisions
-    // add a skip amount and keep trying:
-    //
-    // https://en.wikipedia.org/wiki/Linear_probing
-    //
-    // Len and skip are co-primes, so is guaranteed that repeatedly
-    // adding skip (and subtracting len when needed) all positions are
-    // visited.  1 <= skip < len, and len is prime, so this is guaranteed.
-    //
-    REBLEN len = SER_LEN(hashlist);
-    REBLEN *indexes = SER_HEAD(REBLEN, hashlist);
-
-    uint32_t hash = Hash_Value(key);
-    REBLEN slot = hash % len; // first slot to try for this hash
-    REBLEN skip = hash % (len - 1) + 1; // how much to skip by each collision
+    struct Reb_Hash_Slot *slots = HASHLIST_SLOTS(hashlist);
+    const REBYTE *ctrl = HASHLIST_CTRL(hashlist);
 
-    // Zombie slots are those which are left behind by removing items, with
-    // void values that are illegal in maps, and indicate they can be reused.
-    //
-    REBINT zombie_slot = -1; // no zombies seen yet...
+    REBLEN group_mask = (HASHLIST_CAPACITY(hashlist) / HASH_GROUP_WIDTH) - 1;
+    REBLEN group = HASH_GROUP_SEED(hash) & group_mask;
+    REBYTE fingerprint = HASH_FINGERPRINT(hash);
 
     // You can store information case-insensitively in a MAP!, and it will
     // overwrite the value for at most one other key.  Reading information
     // case-insensitively out of a map can only be done if there aren't two
-    // keys with the same spelling.
+    // keys with the same spelling.  Hash_Value() is case-insensitive, so all
+    // the synonyms share the same hash (and will be found by this probe).
     //
-    REBINT synonym_slot = -1; // no synonyms seen yet...
-
-    REBLEN n;
-    while ((n = indexes[slot]) != 0) {
-        RELVAL *k = ARR_AT(array, (n - 1) * wide); // stored key
-        if (0 == Cmp_Value(k, key, true)) { // exact match
-            if (cased)
-                return slot; // don't need to check synonyms, stop looking
-            goto found_synonym; // confirm exact match is the only match
-        }
+    REBINT synonym_slot = -1;  // no synonyms seen yet...
+
+    REBLEN step = 0;
+    while (true) {
+        const REBYTE *g = ctrl + (group * HASH_GROUP_WIDTH);
+
+        uint64_t mask = Match_Group(g, fingerprint);
+        for (; mask != 0; mask &= mask - 1) {
+            REBLEN slot = (group * HASH_GROUP_WIDTH) + Lowest_Match(mask);
+            if (slots[slot].hash != hash)
+                continue;  // fingerprint collision, skip the Cmp_Value()
+
+            RELVAL *k = ARR_AT(array, (slots[slot].index - 1) * wide);
+            if (0 == Cmp_Value(k, key, true)) {  // exact match
+                if (cased)
+                    return slot;  // don't need to check synonyms, stop
+                goto found_synonym;  // confirm exact match is the only match
+            }
 
-        if (not cased) {
-            if (0 == Cmp_Value(k, key, false)) { // non-strict match
+            if (not cased) {
+                if (0 == Cmp_Value(k, key, false)) {  // non-strict match
 
-              found_synonym:;
+                  found_synonym:;
 
-                if (synonym_slot != -1) // another equivalent already matched
-                    fail (Error_Conflicting_Key(key, specifier));
-                synonym_slot = slot; // save and continue checking
+                    if (synonym_slot != -1)  // another equivalent matched
+                        fail (Error_Conflicting_Key(key, specifier));
+                    synonym_slot = slot;  // save and continue checking
+                }
             }
         }
 
-        if (wide > 1 && IS_NULLED(k + 1) && zombie_slot == -1)
-            zombie_slot = slot;
+        if (Match_Group(g, HASH_CTRL_EMPTY) != 0)
+            break;  // key would have been put in this group if not further
 
-        slot += skip;
-        if (slot >= len)
-            slot -= len;
+        ++step;  // triangular probing visits all groups, and one has EMPTY
+        group = (group + step) & group_mask;
     }
 
-    if (synonym_slot != -1) {
-        assert(not cased);
-        return synonym_slot; // there weren't other spellings of the same key
-    }
+    return synonym_slot;
+}
 
-    if (zombie_slot != -1) { // zombie encountered; overwrite with new key
-        assert(mode == 0);
-        slot = zombie_slot;
-        Derelativize(
-            ARR_AT(array, (indexes[slot] - 1) * wide),
-            key,
-            specifier
-        );
-    }
 
-    if (mode > 1) { // append new value to the target series
-        const RELVAL *src = key;
-        indexes[slot] = (ARR_LEN(array) / wide) + 1;
+//
+//  Add_Hashlist_Entry: C
+//
+// Record that the key with the given (mixed) hash is at the 1-based record
+// `index` in the data array.  The caller must know the key isn't present,
+// and that the hashlist is not at its maximum load.
+//
+void Add_Hashlist_Entry(REBSER *hashlist, uint32_t hash, REBLEN index)
+{
+    struct Reb_Hashlist_Header *header = HASHLIST_HEADER(hashlist);
+    assert(header->count + header->deleted < HASHLIST_MAX_LOAD(
+        header->capacity
+    ));
+
+    REBYTE *ctrl = HASHLIST_CTRL(hashlist);
+
+    REBLEN group_mask = (header->capacity / HASH_GROUP_WIDTH) - 1;
+    REBLEN group = HASH_GROUP_SEED(hash) & group_mask;
 
-        REBLEN index;
-        for (index = 0; index < wide; ++src, ++index)
-            Append_Value_Core(array, src, specifier);
+    REBLEN step = 0;
+    uint64_t mask;
+    while ((mask = Match_Group_Free(ctrl + group * HASH_GROUP_WIDTH)) == 0) {
+        ++step;
+        group = (group + step) & group_mask;
     }
 
-    return (mode > 0) ? -1 : cast(REBINT, slot);
+    REBLEN slot = (group * HASH_GROUP_WIDTH) + Lowest_Match(mask);
+    if (ctrl[slot] == HASH_CTRL_DELETED)
+        --header->deleted;  // reusing a tombstone
+    ++header->count;
+
+    ctrl[slot] = HASH_FINGERPRINT(hash);
+    HASHLIST_SLOTS(hashlist)[slot].hash = hash;
+    HASHLIST_SLOTS(hashlist)[slot].index = index;
 }
 
 
 //
-//  Rehash_Map: C
+//  Remove_Hashlist_Slot: C
 //
-// Recompute the entire hash table for a map. Table must be large enough.
+// A removed slot must usually become a tombstone, because probes for other
+// keys may have passed through its group on the way to where they were put.
+// But if the group still has an EMPTY slot, no probe ever got past it...so
+// the slot can just go back to being EMPTY.
 //
-static void Rehash_Map(REBMAP *map)
+void Remove_Hashlist_Slot(REBSER *hashlist, REBLEN slot)
 {
-    REBSER *hashlist = MAP_HASHLIST(map);
+    struct Reb_Hashlist_Header *header = HASHLIST_HEADER(hashlist);
+    REBYTE *ctrl = HASHLIST_CTRL(hashlist);
+    assert(not (ctrl[slot] & 0x80));  // must be a live slot
 
-    if (!hashlist) return;
+    const REBYTE *g = ctrl + (slot - (slot % HASH_GROUP_WIDTH));
+    if (Match_Group(g, HASH_CTRL_EMPTY) != 0)
+        ctrl[slot] = HASH_CTRL_EMPTY;
+    else {
+        ctrl[slot] = HASH_CTRL_DELETED;
+        ++header->deleted;
+    }
+    --header->count;
+}
 
-    REBLEN *hashes = SER_HEAD(REBLEN, hashlist);
-    REBARR *pairlist = MAP_PAIRLIST(map);
 
-    REBVAL *key = KNOWN(ARR_HEAD(pairlist));
-    REBLEN n;
+//
+//  Find_Key_Hashed: C
+//
+// Returns the hashlist slot of the key's record if found, else -1.
+//
+// Wide: width of record (normally 2, a key and a value).
+//
+// Modes:
+//     0 - search only
+//     1 - search, and if not found append the record to the array and add
+//         it to the hashlist (as used to build results of set operations)
+//
+REBINT Find_Key_Hashed(
+    REBARR *array,
+    REBSER *hashlist,
+    const RELVAL *key,  // !!! assumes key is followed by value(s) via ++
+    REBSPC *specifier,
+    REBLEN wide,
+    bool cased,
+    REBYTE mode
+){
+    uint32_t hash = Mix_Hash(Hash_Value(key));
+    REBINT slot = Find_Hashed(
+        array, hashlist, key, specifier, wide, cased, hash
+    );
 
-    for (n = 0; n < ARR_LEN(pairlist); n += 2, key += 2) {
-        const bool cased = true; // cased=true is always fine
+    if (slot != -1 or mode == 0)
+        return slot;
 
-        if (IS_NULLED(key + 1)) {
-            //
-            // It's a "zombie", move last key to overwrite it
-            //
-            Move_Value(
-                key, KNOWN(ARR_AT(pairlist, ARR_LEN(pairlist) - 2))
-            );
-            Move_Value(
-                &key[1], KNOWN(ARR_AT(pairlist, ARR_LEN(pairlist) - 1))
-            );
-            SET_ARRAY_LEN_NOTERM(pairlist, ARR_LEN(pairlist) - 2);
-        }
+    Add_Hashlist_Entry(hashlist, hash, (ARR_LEN(array) / wide) + 1);
 
-        REBLEN hash = Find_Key_Hashed(
-            pairlist, hashlist, key, SPECIFIED, 2, cased, 0
-        );
-        hashes[hash] = n / 2 + 1;
+    const RELVAL *src = key;
+    REBLEN index;
+    for (index = 0; index < wide; ++src, ++index)
+        Append_Value_Core(array, src, specifier);
 
-        // discard zombies at end of pairlist
-        //
-        while (IS_NULLED(ARR_AT(pairlist, ARR_LEN(pairlist) - 1))) {
-            SET_ARRAY_LEN_NOTERM(pairlist, ARR_LEN(pairlist) - 2);
-        }
+    return -1;
+}
+
+
+//
+//  Rebuild_Hashlist: C
+//
+// Remake the hashlist at a new capacity (which drops all the tombstones),
+// putting the live entries back using the hashes stored in their slots.  If
+// `renumber` is given, the record indices are mapped through it (this is
+// used when a map's pairlist has had its zombies squeezed out).
+//
+static void Rebuild_Hashlist(
+    REBSER *hashlist,
+    REBLEN capacity,
+    const REBLEN *renumber
+){
+    struct Reb_Hashlist_Header *header = HASHLIST_HEADER(hashlist);
+    REBLEN old_capacity = header->capacity;
+    REBLEN count = header->count;
+    assert(count < HASHLIST_MAX_LOAD(capacity));
+
+    struct Reb_Hash_Slot *live = ALLOC_N(struct Reb_Hash_Slot, count + 1);
+
+    struct Reb_Hash_Slot *slots = HASHLIST_SLOTS(hashlist);
+    const REBYTE *ctrl = HASHLIST_CTRL(hashlist);
+
+    REBLEN n = 0;
+    REBLEN slot;
+    for (slot = 0; slot < old_capacity; ++slot) {
+        if (ctrl[slot] & 0x80)
+            continue;  // EMPTY or DELETED
+        live[n] = slots[slot];
+        if (renumber)
+            live[n].index = renumber[live[n].index];
+        assert(live[n].index != 0);
+        ++n;
     }
+    assert(n == count);
+
+    Remake_Series(  // not(NODE_FLAG_NODE) => don't keep data
+        hashlist,
+        Hashlist_Size(capacity),
+        1,
+        SERIES_FLAG_POWER_OF_2
+    );
+    Init_Hashlist(hashlist, capacity);
+
+    for (n = 0; n < count; ++n)
+        Add_Hashlist_Entry(hashlist, live[n].hash, live[n].index);
+
+    FREE_N(struct Reb_Hash_Slot, count + 1, live);
 }
 
 
 //
-//  Expand_Hash: C
+//  Rehash_Map: C
 //
-// Expand hash series. Clear it but set its tail.
+// Squeeze the zombie pairs out of the pairlist (keeping the order of the
+// live ones) and rebuild the hashlist at a size with room for more keys.
+// The hashes stored in the slots are reused, so no keys are re-hashed.
 //
-void Expand_Hash(REBSER *ser)
+static void Rehash_Map(REBMAP *map)
 {
-    assert(not IS_SER_ARRAY(ser));
-
-    REBINT prime = Get_Hash_Prime_May_Fail(SER_LEN(ser) + 1);
-    Remake_Series(
-        ser,
-        prime + 1,
-        SER_WIDE(ser),
-        SERIES_FLAG_POWER_OF_2  // not(NODE_FLAG_NODE) => don't keep data
+    REBSER *hashlist = MAP_HASHLIST(map);
+    REBARR *pairlist = MAP_PAIRLIST(map);
+    struct Reb_Hashlist_Header *header = HASHLIST_HEADER(hashlist);
+
+    REBLEN num_pairs = ARR_LEN(pairlist) / 2;
+    REBLEN *renumber = nullptr;
+
+    if (header->zombies != 0) {
+        renumber = ALLOC_N(REBLEN, num_pairs + 1);
+        renumber[0] = 0;  // not a valid 1-based index
+
+        REBVAL *src = KNOWN(ARR_HEAD(pairlist));
+        REBVAL *dest = src;
+        REBLEN kept = 0;
+        REBLEN n;
+        for (n = 1; n <= num_pairs; ++n, src += 2) {
+            if (IS_NULLED(src + 1)) {
+                renumber[n] = 0;  // zombie, has no slot to renumber
+                continue;
+            }
+            renumber[n] = ++kept;
+            if (dest != src) {
+                Move_Value(dest, src);
+                Move_Value(dest + 1, src + 1);
+            }
+            dest += 2;
+        }
+        assert(kept == header->count);
+        TERM_ARRAY_LEN(pairlist, kept * 2);
+        header->zombies = 0;
+    }
+
+    Rebuild_Hashlist(
+        hashlist,
+        Hashlist_Capacity_For(header->count + 1),
+        renumber
     );
 
-    Clear_Series(ser);
-    SET_SERIES_LEN(ser, prime);
+    if (renumber)
+        FREE_N(REBLEN, num_pairs + 1, renumber);
 }
 
 
@@ -260,25 +439,16 @@ REBLEN Find_Map_Entry(
 ) {
     assert(not IS_NULLED(key));
 
-    REBSER *hashlist = MAP_HASHLIST(map); // can be null
+    REBSER *hashlist = MAP_HASHLIST(map);
     REBARR *pairlist = MAP_PAIRLIST(map);
 
-    assert(hashlist);
-
-    // Get hash table, expand it if needed:
-    if (ARR_LEN(pairlist) > SER_LEN(hashlist) / 2) {
-        Expand_Hash(hashlist); // modifies size value
-        Rehash_Map(map);
-    }
-
     const REBLEN wide = 2;
-    const REBYTE mode = 0; // just search for key, don't add it
-    REBLEN slot = Find_Key_Hashed(
-        pairlist, hashlist, key, key_specifier, wide, cased, mode
+    uint32_t hash = Mix_Hash(Hash_Value(key));
+    REBINT slot = Find_Hashed(
+        pairlist, hashlist, key, key_specifier, wide, cased, hash
     );
 
-    REBLEN *indexes = SER_HEAD(REBLEN, hashlist);
-    REBLEN n = indexes[slot];
+    REBLEN n = (slot == -1) ? 0 : HASHLIST_SLOTS(hashlist)[slot].index;
 
     // n==0 or pairlist[(n-1)*]=~key
 
@@ -293,6 +463,8 @@ REBLEN Find_Map_Entry(
     REBSER *locker = SER(MAP_PAIRLIST(map));
     Ensure_Value_Frozen(key, locker);
 
+    Remember_Series_Write(SER(pairlist));  // key and value may be young
+
     // Must set the value:
     if (n) {  // re-set it:
         Derelativize(
@@ -300,18 +472,38 @@ REBLEN Find_Map_Entry(
             val,
             val_specifier
         );
+
+        if (IS_NULLED(val)) {  // removal, leaves a zombie pair behind
+            Remove_Hashlist_Slot(hashlist, slot);
+            ++HASHLIST_HEADER(hashlist)->zombies;
+        }
         return n;
     }
 
     if (IS_NULLED(val)) return 0; // trying to remove non-existing key
 
+    // Get room in the hash table if needed.  Also rehash if zombies outnumber
+    // the live pairs, so removals followed by insertions of different keys
+    // can't grow the pairlist without bound.
+    //
+    struct Reb_Hashlist_Header *header = HASHLIST_HEADER(hashlist);
+    if (
+        header->count + header->deleted + 1
+            >= HASHLIST_MAX_LOAD(header->capacity)
+        or header->zombies > header->count
+    ){
+        Rehash_Map(map);
+    }
+
     // Create new entry.  Note that it does not copy underlying series (e.g.
     // the data of a string), which is why the immutability test is necessary
     //
     Append_Value_Core(pairlist, key, key_specifier);
     Append_Value_Core(pairlist, val, val_specifier);
 
-    return (indexes[slot] = (ARR_LEN(pairlist) / 2));
+    n = ARR_LEN(pairlist) / 2;
+    Add_Hashlist_Entry(hashlist, hash, n);
+    return n;
 }
 
 
@@ -350,7 +542,7 @@ REB_R PD_Map(
     );
 
     if (opt_setval != NULL) {
-        assert(n != 0);
+        assert(n != 0 or IS_NULLED(opt_setval));  // removing absent key ok
         return R_INVISIBLE;
     }
 
@@ -487,7 +679,6 @@ REB_R TO_Map(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg)
 
         REBMAP *map = Make_Map(len / 2); // [key value key value...] + END
         Append_Map(map, array, index, specifier, len);
-        Rehash_Map(map);
         return Init_Map(out, map);
     }
     else if (IS_MAP(arg)) {
@@ -775,9 +966,12 @@ REBTYPE(Map)
         Reset_Array(MAP_PAIRLIST(map));
 
         // !!! Review: should the space for the hashlist be reclaimed?  This
-        // clears all the indices but doesn't scale back the size.
+        // clears all the slots but doesn't scale back the capacity.
         //
-        Clear_Series(MAP_HASHLIST(map));
+        Init_Hashlist(
+            MAP_HASHLIST(map),
+            HASHLIST_CAPACITY(MAP_HASHLIST(map))
+        );
 
         return Init_Map(D_OUT, map);
 
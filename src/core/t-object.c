@@ -324,6 +324,7 @@ REB_R MAKE_Context(
         // !!! This binds the actual body data, not a copy of it.  See
         // Virtual_Bind_Deep_To_New_Context() for future directions.
         //
+        Remember_Series_Write(SER(VAL_ARRAY(arg)));  // bindings will change
         Bind_Values_Deep(VAL_ARRAY_AT(arg), ctx);
 
         DECLARE_LOCAL (dummy);
@@ -489,10 +490,14 @@ REBNATIVE(set_meta)
 
     REBVAL *v = ARG(value);
 
-    if (IS_ACTION(v))
+    if (IS_ACTION(v)) {
+        Remember_Series_Write(SER(VAL_ACT_PARAMLIST(v)));
         MISC_META_NODE(VAL_ACT_PARAMLIST(v)) = NOD(meta);
-    else
+    }
+    else {
+        Remember_Series_Write(SER(CTX_VARLIST(VAL_CONTEXT(v))));
         MISC_META_NODE(VAL_CONTEXT(v)) = NOD(meta);
+    }
 
     if (not meta)
         return nullptr;
@@ -917,6 +922,7 @@ REBNATIVE(construct)
     // !!! This binds the actual body data, not a copy of it.  See
     // Virtual_Bind_Deep_To_New_Context() for future directions.
     //
+    Remember_Series_Write(SER(VAL_ARRAY(spec)));  // bindings will change
     Bind_Values_Deep(VAL_ARRAY_AT(spec), context);
 
     DECLARE_LOCAL (dummy);
@@ -497,6 +497,58 @@ static int Compare_Chr(void *thunk, const void *v1, const void *v2)
 }
 
 
+//
+//  Sort_Chars: C
+//
+// Stable counting sort of ASCII bytes, used when the records of a string
+// sort are single characters.  There are only 128 possible keys, so this is
+// linear in the length of the string.  Without /CASE, "A" and "a" share a
+// key and keep their original order relative to each other.
+//
+static void Sort_Chars(REBYTE *bp, REBLEN len, bool ccase, bool rev)
+{
+    REBLEN count[0x80];
+    memset(count, 0, sizeof(count));
+
+    REBLEN i;
+    for (i = 0; i < len; ++i) {
+        assert(bp[i] < 0x80);
+        ++count[ccase ? bp[i] : LO_CASE(bp[i])];
+    }
+
+    if (ccase) {  // keys are the bytes themselves, so just write them out
+        REBYTE *dest = bp;
+        int n;
+        for (n = 0; n < 0x80; ++n) {
+            int key = rev ? 0x7F - n : n;
+            memset(dest, key, count[key]);
+            dest += count[key];
+        }
+        return;
+    }
+
+    REBLEN pos = 0;
+    int n;
+    for (n = 0; n < 0x80; ++n) {
+        int key = rev ? 0x7F - n : n;
+        REBLEN c = count[key];
+        count[key] = pos;
+        pos += c;
+    }
+
+    REBSER *copy = Make_Series_Core(
+        len,
+        sizeof(REBYTE),
+        SERIES_FLAG_ALWAYS_DYNAMIC
+    );
+    REBYTE *src = BIN_HEAD(copy);
+    memcpy(src, bp, len);
+    for (i = 0; i < len; ++i)
+        bp[count[LO_CASE(src[i])]++] = src[i];
+    Free_Unmanaged_Series(copy);
+}
+
+
 //
 //  Sort_String: C
 //
@@ -530,6 +582,11 @@ static void Sort_String(
             fail (skipv);
     }
 
+    if (skip == 1) {
+        Sort_Chars(VAL_RAW_DATA_AT(string), len, ccase, rev);
+        return;
+    }
+
     // Use fast quicksort library function:
     if (skip > 1) {
         len /= skip;
@@ -1072,9 +1129,13 @@ REBTYPE(String)
         REBSIZ size_old = STR_SIZE(s);
 
         Remove_Series_Units(SER(s), offset, size);  // should keep terminator
-        Free_Bookmarks_Maybe_Null(s);
         SET_STR_LEN_SIZE(s, tail - len, size_old - size);  // no term needed
 
+        if (STR_LEN(s) < sizeof(REBVAL))  // not kept if small
+            Free_Bookmarks_Maybe_Null(s);
+        else
+            Update_Bookmarks_For_Modify(s, index, offset);
+
         RETURN (v); }
 
     //-- Modification:
@@ -1282,17 +1343,18 @@ REBTYPE(String)
 
         UNUSED(ARG(value1)); // covered by value
 
-        return Init_Any_Series(
-            D_OUT,
-            VAL_TYPE(v),
-            Make_Set_Operation_Series(
-                v,
-                ARG(value2),
-                sop_flags,
-                did REF(case),
-                REF(skip) ? Int32s(ARG(skip), 1) : 1
-            )
-        ); }
+        REBSER *ser = Make_Set_Operation_Series(
+            v,
+            ARG(value2),
+            sop_flags,
+            did REF(case),
+            REF(skip) ? Int32s(ARG(skip), 1) : 1,
+            REF(into) ? ARG(into) : nullptr
+        );
+        if (not ser)
+            RETURN (ARG(into));
+
+        return Init_Any_Series(D_OUT, VAL_TYPE(v), ser); }
 
     //-- Special actions:
 
@@ -1331,6 +1393,9 @@ REBTYPE(String)
         if (REF(all))
             fail (Error_Bad_Refine_Raw(ARG(all)));
 
+        if (REF(key))
+            fail (Error_Bad_Refine_Raw(ARG(key)));
+
         if (not Is_String_Definitely_ASCII(v))
             fail ("UTF-8 Everywhere: String sorting temporarily unavailable");
 
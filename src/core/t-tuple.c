@@ -329,6 +329,9 @@ REBTYPE(Tuple)
 
     REBSYM sym = VAL_WORD_SYM(verb);
 
+    if (sym == SYM_INTERSECT or sym == SYM_UNION or sym == SYM_DIFFERENCE)
+        Fail_If_Set_Operation_Into(frame_);  // bitwise, no series result
+
     // !!! This used to depend on "IS_BINARY_ACT", a concept that does not
     // exist any longer with symbol-based action dispatch.  Patch with more
     // elegant mechanism.
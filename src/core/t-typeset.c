@@ -410,6 +410,8 @@ REBTYPE(Typeset)
       case SYM_INTERSECT:
       case SYM_UNION:
       case SYM_DIFFERENCE: {
+        Fail_If_Set_Operation_Into(frame_);
+
         REBVAL *arg = D_ARG(2);
 
         if (IS_DATATYPE(arg)) {
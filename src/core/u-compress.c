@@ -28,8 +28,8 @@
 //
 // Options are offered for using zlib envelope, gzip envelope, or raw deflate.
 //
-// !!! zlib is designed to do streaming compression.  While that code is
-// part of the linked in library, it's not exposed by this interface.
+// zlib's streaming compression is exposed with the ZSTREAM and
+// ZSTREAM-UPDATE natives, for data too big to handle all at once.
 //
 // !!! Since the zlib code/API isn't actually modified, one could dynamically
 // link to a zlib on the platform instead of using the extracted version.
@@ -385,6 +385,303 @@ unsigned char *Decompress_Alloc_Core(
 }
 
 
+//=//// STREAMING ZLIB ////////////////////////////////////////////////////=//
+//
+// Compress_Alloc_Core() and Decompress_Alloc_Core() need all of the input in
+// memory at once, and make all of the output at once.  For something like a
+// big gzip'd log file that can take several times its size in memory.
+//
+// ZSTREAM makes a HANDLE! holding a z_stream, and ZSTREAM-UPDATE feeds it
+// pieces of input and gives back whatever output that produced.  Memory use
+// is then bounded by the chunk sizes plus zlib's own state, which is a bit
+// over 256K to deflate and about 40K to inflate at the default settings
+// (/WINDOW can shrink both).  Usermode code can feed it
+// from a file or network port as data arrives, see ZSTREAM-COPY.
+//
+// Unlike the one-shot routines, the zlib state can't use rebMalloc(): that
+// memory is freed if any fail() unwinds past where it was allocated, and the
+// stream has to outlive the call that made it.  So it's allocated with
+// Alloc_Mem(), and released when the GC frees the HANDLE!.
+//
+
+#define ZSTREAM_OUT_CHUNK 16384  // output space to make available per step
+
+struct Reb_Zstream {
+    z_stream strm;
+    bool inflating;
+    bool gzip;  // inflating with GZIP or DETECT, may see gzip concatenations
+    bool ended;  // Z_STREAM_END was reached (deflate finished, or inflate
+        // got to the end of the compressed data)
+};
+
+static void *zalloc_stream(void *opaque, unsigned nr, unsigned size)
+{
+    UNUSED(opaque);
+    size_t total = cast(size_t, nr) * size;
+    REBYTE *p = cast(REBYTE*, Alloc_Mem(ALIGN_SIZE + total));
+    if (not p)
+        return Z_NULL;  // zlib gives Z_MEM_ERROR, reported as an error
+    *cast(size_t*, p) = total;  // Free_Mem() has to be told the size
+    return p + ALIGN_SIZE;
+}
+
+static void zfree_stream(void *opaque, void *addr)
+{
+    UNUSED(opaque);
+    REBYTE *p = cast(REBYTE*, addr) - ALIGN_SIZE;
+    Free_Mem(p, ALIGN_SIZE + *cast(size_t*, p));
+}
+
+static void Cleanup_Zstream(const REBVAL *v)
+{
+    struct Reb_Zstream *zs = VAL_HANDLE_POINTER(struct Reb_Zstream, v);
+    if (zs->inflating)
+        inflateEnd(&zs->strm);
+    else
+        deflateEnd(&zs->strm);
+    Free_Mem(zs, sizeof(struct Reb_Zstream));
+}
+
+
+//
+//  zstream: native [
+//
+//  {Make a state for DEFLATE (or INFLATE) of data that comes in pieces}
+//
+//      return: "Pass to ZSTREAM-UPDATE"
+//          [handle!]
+//      /inflate "Decompress instead of compress"
+//      /envelope "ZLIB, GZIP, or (to inflate) DETECT, default is raw DEFLATE"
+//          [word!]
+//      /level "Compression level, from 0 (none) to 9 (smallest but slowest)"
+//          [integer!]
+//      /window "History size as a power of 2, 9 to 15 (32K, the default)"
+//          [integer!]
+//  ]
+//
+REBNATIVE(zstream)
+//
+// Inflating needs a window at least as big as the one compressed with, so
+// /WINDOW is only useful for that if the data is known to have been made
+// with a smaller one.
+{
+    INCLUDE_PARAMS_OF_ZSTREAM;
+
+    int bits = MAX_WBITS;
+    if (REF(window)) {
+        bits = Int32(ARG(window));
+        if (bits < 9 or bits > MAX_WBITS)
+            fail (PAR(window));
+    }
+
+    int level = Z_DEFAULT_COMPRESSION;
+    if (REF(level)) {
+        if (REF(inflate))
+            fail (Error_Bad_Refines_Raw());
+        level = Int32(ARG(level));
+        if (level < 0 or level > 9)
+            fail (PAR(level));
+    }
+
+    int window_bits = -bits;  // raw
+    bool gzip = false;
+    if (REF(envelope)) {
+        switch (VAL_WORD_SYM(ARG(envelope))) {
+          case SYM_ZLIB:
+            window_bits = bits;
+            break;
+
+          case SYM_GZIP:
+            window_bits = bits | 16;  // see notes on window_bits_gzip
+            gzip = true;
+            break;
+
+          case SYM_DETECT:
+            if (not REF(inflate))
+                fail (PAR(envelope));
+            window_bits = bits | 32;
+            gzip = true;
+            break;
+
+          default:
+            fail (PAR(envelope));
+        }
+    }
+
+    struct Reb_Zstream *zs = cast(
+        struct Reb_Zstream*, Alloc_Mem(sizeof(struct Reb_Zstream))
+    );
+    zs->strm.zalloc = &zalloc_stream;
+    zs->strm.zfree = &zfree_stream;
+    zs->strm.opaque = nullptr;
+    zs->strm.next_in = nullptr;
+    zs->strm.avail_in = 0;
+    zs->inflating = did REF(inflate);
+    zs->gzip = gzip;
+    zs->ended = false;
+
+    int ret;
+    if (zs->inflating)
+        ret = inflateInit2(&zs->strm, window_bits);
+    else {
+        ret = deflateInit2(
+            &zs->strm,
+            level,
+            Z_DEFLATED,
+            window_bits,
+            8,
+            Z_DEFAULT_STRATEGY
+        );
+    }
+    if (ret != Z_OK) {
+        DECLARE_LOCAL (arg);
+        Init_Integer(arg, ret);
+        Free_Mem(zs, sizeof(struct Reb_Zstream));
+        fail (Error_Bad_Compression_Raw(arg));
+    }
+
+    return Init_Handle_Cdata_Managed(
+        D_OUT,
+        zs,
+        sizeof(struct Reb_Zstream),
+        &Cleanup_Zstream
+    );
+}
+
+
+//
+//  zstream-update: native [
+//
+//  {Feed input to a ZSTREAM, and get back the output that has resulted}
+//
+//      return: "May be empty, as zlib holds on to data while it can"
+//          [binary!]
+//      stream [handle!]
+//      data "If text, it will be UTF-8 encoded (BLANK! if no more input)"
+//          [binary! text! blank!]
+//      /part "Length of data (elements)"
+//          [any-value!]
+//      /finish "No more input follows, flush the rest of the output"
+//      /into "Append output to this binary instead of making a new one"
+//          [binary!]
+//  ]
+//
+REBNATIVE(zstream_update)
+//
+// When inflating, /FINISH is an error if the data given so far did not reach
+// the end of the compressed stream.  A GZIP or DETECT inflate that reaches
+// the end of one gzip member will start on another if more data follows (the
+// `gzip` tool may concatenate them).  Zero bytes after the end are skipped.
+{
+    INCLUDE_PARAMS_OF_ZSTREAM_UPDATE;
+
+    REBVAL *stream = ARG(stream);
+    if (VAL_HANDLE_CLEANER(stream) != &Cleanup_Zstream)
+        fail (PAR(stream));
+    struct Reb_Zstream *zs = VAL_HANDLE_POINTER(struct Reb_Zstream, stream);
+
+    const REBYTE *bp;
+    REBSIZ size;
+    if (IS_BLANK(ARG(data))) {
+        bp = nullptr;
+        size = 0;
+    }
+    else {
+        REBLEN limit = Part_Len_May_Modify_Index(ARG(data), ARG(part));
+        bp = VAL_BYTES_LIMIT_AT(&size, ARG(data), limit);
+    }
+
+    if (zs->ended and not zs->inflating and (size != 0 or not REF(finish)))
+        fail ("ZSTREAM-UPDATE stream already finished");
+
+    REBBIN *bin;
+    if (REF(into)) {
+        FAIL_IF_READ_ONLY(ARG(into));
+        bin = VAL_BINARY(ARG(into));
+
+        // Extending the output may move its data, which `next_in` points
+        // into if the input is the same series.
+        //
+        if (not IS_BLANK(ARG(data)) and VAL_SERIES(ARG(data)) == bin)
+            fail ("ZSTREAM-UPDATE/INTO can't be the series of its data");
+    }
+    else
+        bin = Make_Binary(zs->inflating ? size * 3 : size / 2);
+
+    z_stream *strm = &zs->strm;
+    strm->next_in = cast(const z_Bytef*, bp);
+    strm->avail_in = size;
+
+    int flush = REF(finish) ? Z_FINISH : Z_NO_FLUSH;
+
+    while (true) {
+        if (zs->ended) {
+            if (not zs->inflating)
+                break;  // deflate finished, nothing more will come out
+
+            while (strm->avail_in != 0 and *strm->next_in == 0) {
+                ++strm->next_in;  // skip trailing zeros after gzip member
+                --strm->avail_in;
+            }
+            if (strm->avail_in == 0)
+                break;
+            if (not zs->gzip)
+                fail ("Data after end of ZSTREAM-UPDATE compressed stream");
+
+            inflateReset(strm);  // another gzip member follows
+            zs->ended = false;
+        }
+
+        REBLEN len = BIN_LEN(bin);
+        if (SER_REST(bin) - len - 1 < ZSTREAM_OUT_CHUNK)
+            Extend_Series(bin, ZSTREAM_OUT_CHUNK + 1);  // +1 for terminator
+        REBLEN avail = SER_REST(bin) - len - 1;
+
+        strm->next_out = BIN_AT(bin, len);
+        strm->avail_out = avail;
+
+        int ret = zs->inflating
+            ? inflate(strm, Z_NO_FLUSH)
+            : deflate(strm, flush);
+
+        TERM_BIN_LEN(bin, len + (avail - strm->avail_out));
+
+        if (ret == Z_STREAM_END) {
+            zs->ended = true;
+            continue;
+        }
+
+        if (ret == Z_BUF_ERROR) {
+            //
+            // Not fatal: no progress was possible.  That means more input is
+            // needed (as output space was offered).
+            //
+            assert(strm->avail_in == 0);
+            break;
+        }
+
+        if (ret != Z_OK)
+            fail (Error_Compression(strm, ret));
+
+        if (strm->avail_out != 0 and strm->avail_in == 0) {
+            if (zs->inflating or flush != Z_FINISH)
+                break;  // used all the input, and all output is flushed
+        }
+    }
+
+    strm->next_in = nullptr;  // don't hold onto pointer into the data
+    assert(strm->avail_in == 0);
+
+    if (REF(finish) and zs->inflating and not zs->ended)
+        fail ("ZSTREAM-UPDATE/FINISH before end of compressed stream");
+
+    if (REF(into))
+        RETURN (ARG(into));
+
+    return Init_Binary(D_OUT, bin);
+}
+
+
 //
 //  checksum-core: native [
 //
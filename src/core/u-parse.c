@@ -102,7 +102,10 @@
 #define P_COLLECTION \
     (IS_BLANK(P_COLLECTION_VALUE) ? nullptr : VAL_ARRAY(P_COLLECTION_VALUE))
 
-#define P_NUM_QUOTES_VALUE  (f->rootvar + 4)
+#define P_MEMO_VALUE        (f->rootvar + 4)
+#define P_MEMO              VAL_PARSE_MEMO(P_MEMO_VALUE)
+
+#define P_NUM_QUOTES_VALUE  (f->rootvar + 5)
 #define P_NUM_QUOTES        VAL_INT32(P_NUM_QUOTES_VALUE)
 
 #define P_OUT (f->out)
@@ -181,6 +184,955 @@ inline static REBSYM VAL_CMD(const RELVAL *v) {
 }
 
 
+//=//// COMPILED RULE PROGRAMS ////////////////////////////////////////////=//
+//
+// Running each rule through a SUBPARSE frame makes PARSE easy to debug and
+// lets it handle every construct uniformly.  But most of the time is spent
+// on the common subset: literal chars and strings, bitsets, SKIP and END,
+// alternates, repetition, and nested or word-fetched blocks.  When a block
+// of rules contains *only* these things, it is compiled into a flat list
+// of steps that can match string and binary input without making frames.
+//
+// Compiled programs are pure recognizers: they can't COPY, SET, KEEP, or run
+// GROUP!s.  That means anything they can't deal with at runtime (say a word
+// whose value turned out to be a DATATYPE!) can "bail", and the block is
+// run by the interpreter from the beginning with no harm done.  A block that
+// bailed or that didn't compile is remembered as such, so it isn't retried.
+//
+// Programs are found by the (array, index) of the rules, and any array that
+// has programs is marked with ARRAY_FLAG_PARSE_COMPILED.  Words are not
+// looked up until the program runs, so changing a variable does not need to
+// invalidate anything.  But modifying the array (see FAIL_IF_READ_ONLY_SER)
+// or freeing it (see Decay_Series) calls Forget_Parse_Programs().
+//
+// !!! The interpreter remains authoritative: tracing, PF_ONE_RULE steps, and
+// block input always use it.  Each step here must mirror what the SUBPARSE
+// loop would do with the same rule, including its quirks (e.g. ANY and SOME
+// stopping at the tail, but WHILE not).
+//
+
+#define BAIL_FLAG ((REBLEN)(-3))  // compiled program can't run, interpret
+
+enum Reb_Parse_Op {
+    PARSE_OP_ALT,  // `|`, success if reached
+    PARSE_OP_CHAR,
+    PARSE_OP_SEQUENCE,  // TEXT!, BINARY!, TAG!, etc. via Find_In_Any_Sequence
+    PARSE_OP_BITSET,
+    PARSE_OP_SKIP,
+    PARSE_OP_END,
+    PARSE_OP_BLOCK,
+    PARSE_OP_WORD  // fetched when run, then treated as one of the above
+};
+
+struct Reb_Parse_Step {
+    enum Reb_Parse_Op op;
+    bool any_or_some;  // stop iterating at the tail (WHILE does not)
+    REBINT mincount;
+    REBINT maxcount;
+    REBLEN index;  // of the rule cell in the program's array
+    REBLEN next_alt;  // step to resume at if this one fails
+};
+
+struct Reb_Parse_Program {
+    struct Reb_Parse_Program *next;  // in hash bucket (same array)
+    REBARR *array;
+    REBLEN index;
+    REBLEN len;  // ARR_LEN() when compiled, paranoid check when run
+    bool compiled;  // false if the rules need the interpreter
+    REBLEN num_steps;
+    REBLEN capacity;
+    struct Reb_Parse_Step *steps;
+};
+
+static struct Reb_Parse_Program **PG_Parse_Buckets;
+static REBLEN PG_Parse_Num_Buckets;
+static REBLEN PG_Parse_Num_Programs;
+static REBLEN PG_Parse_Epoch;  // bumped when programs are forgotten
+
+#define PARSE_MIN_BUCKETS 64
+
+inline static REBLEN Parse_Bucket(REBARR *a, REBLEN num_buckets) {
+    uintptr_t p = cast(uintptr_t, a);
+    return ((p >> 4) ^ (p >> 12)) & (num_buckets - 1);  // power of 2
+}
+
+static void Free_Parse_Program(struct Reb_Parse_Program *prog) {
+    if (prog->steps)
+        FREE_N(struct Reb_Parse_Step, prog->capacity, prog->steps);
+    FREE(struct Reb_Parse_Program, prog);
+    --PG_Parse_Num_Programs;
+}
+
+static void Expand_Parse_Buckets(void) {
+    REBLEN new_num = PG_Parse_Num_Buckets * 2;
+    struct Reb_Parse_Program **new_buckets = ALLOC_N_ZEROFILL(
+        struct Reb_Parse_Program*, new_num
+    );
+
+    REBLEN n;
+    for (n = 0; n < PG_Parse_Num_Buckets; ++n) {
+        struct Reb_Parse_Program *prog = PG_Parse_Buckets[n];
+        while (prog) {
+            struct Reb_Parse_Program *next = prog->next;
+            REBLEN b = Parse_Bucket(prog->array, new_num);
+            prog->next = new_buckets[b];
+            new_buckets[b] = prog;
+            prog = next;
+        }
+    }
+
+    FREE_N(
+        struct Reb_Parse_Program*, PG_Parse_Num_Buckets, PG_Parse_Buckets
+    );
+    PG_Parse_Buckets = new_buckets;
+    PG_Parse_Num_Buckets = new_num;
+}
+
+
+// Only compile arrays that are plain source (the array flag used to mark a
+// compiled array means other things for paramlists, varlists, etc.)
+//
+inline static bool Is_Parse_Compilable_Array(REBARR *a) {
+    return not (SER(a)->header.bits & (
+        ARRAY_FLAG_IS_PARAMLIST | ARRAY_FLAG_IS_VARLIST
+            | ARRAY_FLAG_IS_PAIRLIST
+    ));
+}
+
+
+// Fill in the steps for the rules at the program's array and index.  If any
+// rule is outside the subset which compiled programs handle, leave it with
+// `compiled` as false.
+//
+static void Compile_Parse_Program(struct Reb_Parse_Program *prog)
+{
+    REBARR *a = prog->array;
+    prog->compiled = false;
+    prog->num_steps = 0;
+    prog->capacity = 0;
+    prog->steps = nullptr;
+
+    if (prog->index > ARR_LEN(a))
+        return;
+
+    prog->capacity = ARR_LEN(a) - prog->index + 1;  // 1 for empty blocks
+    prog->steps = ALLOC_N(struct Reb_Parse_Step, prog->capacity);
+
+    REBLEN index = prog->index;
+    const RELVAL *rule = ARR_AT(a, index);
+    for (; NOT_END(rule); ++rule, ++index) {
+        struct Reb_Parse_Step *step = &prog->steps[prog->num_steps];
+        step->any_or_some = false;
+        step->mincount = 1;
+        step->maxcount = 1;
+
+        if (IS_BAR(rule)) {
+            step->op = PARSE_OP_ALT;
+            step->index = index;
+            ++prog->num_steps;
+            continue;
+        }
+
+        if (IS_WORD(rule)) {  // prefixes (only one is allowed here)
+            switch (VAL_CMD(rule)) {
+              case SYM_WHILE:
+                step->mincount = 0;
+                step->maxcount = INT32_MAX;
+                goto prefix;
+
+              case SYM_ANY:
+                step->mincount = 0;
+                goto sym_some;
+
+              case SYM_SOME:
+              sym_some:
+                step->any_or_some = true;
+                step->maxcount = INT32_MAX;
+                goto prefix;
+
+              case SYM_OPT:
+                step->mincount = 0;
+                goto prefix;
+
+              default:
+                break;
+            }
+        }
+        else if (IS_INTEGER(rule)) {
+            if (VAL_INT64(rule) < 0 or VAL_INT64(rule) > INT32_MAX)
+                return;  // let the interpreter give the error
+            step->mincount = step->maxcount = VAL_INT32(rule);
+
+            if (NOT_END(rule + 1) and IS_INTEGER(rule + 1)) {
+                ++rule;
+                ++index;
+                if (VAL_INT64(rule) < 0 or VAL_INT64(rule) > INT32_MAX)
+                    return;
+                step->maxcount = VAL_INT32(rule);
+            }
+            goto prefix;
+        }
+
+        goto atom;
+
+      prefix:
+
+        ++rule;
+        ++index;
+
+      atom:
+
+        if (IS_END(rule))
+            return;  // e.g. `[some]`, interpreter gives the error
+
+        step->index = index;
+
+        switch (VAL_TYPE(rule)) {
+          case REB_CHAR:
+            if (VAL_CHAR(rule) == 0)
+                return;
+            step->op = PARSE_OP_CHAR;
+            break;
+
+          case REB_TEXT:
+          case REB_BINARY:
+          case REB_TAG:
+          case REB_FILE:
+          case REB_EMAIL:
+            step->op = PARSE_OP_SEQUENCE;
+            break;
+
+          case REB_BITSET:
+            step->op = PARSE_OP_BITSET;
+            break;
+
+          case REB_BLOCK:
+            step->op = PARSE_OP_BLOCK;
+            break;
+
+          case REB_WORD:
+            switch (VAL_CMD(rule)) {
+              case SYM_0:
+                step->op = PARSE_OP_WORD;
+                break;
+
+              case SYM_SKIP:
+                step->op = PARSE_OP_SKIP;
+                break;
+
+              case SYM_END:
+                step->op = PARSE_OP_END;
+                break;
+
+              default:  // includes BAR!, e.g. `some |`
+                return;
+            }
+            break;
+
+          default:
+            return;
+        }
+
+        ++prog->num_steps;
+    }
+
+    // A failed step resumes after the next `|`, or the whole program fails
+    //
+    REBLEN next_alt = prog->num_steps;
+    REBLEN n = prog->num_steps;
+    while (n != 0) {
+        --n;
+        prog->steps[n].next_alt = next_alt;
+        if (prog->steps[n].op == PARSE_OP_ALT)
+            next_alt = n;
+    }
+
+    prog->len = ARR_LEN(a);
+    prog->compiled = true;
+}
+
+
+// Get the program for the rules at an array and index, compiling it if this
+// is the first time it's been asked for.  Returns nullptr if the rules have
+// to be interpreted.
+//
+static struct Reb_Parse_Program *Get_Parse_Program(REBARR *a, REBLEN index)
+{
+    if (not Is_Parse_Compilable_Array(a))
+        return nullptr;
+
+    REBLEN b = Parse_Bucket(a, PG_Parse_Num_Buckets);
+    struct Reb_Parse_Program *prog = PG_Parse_Buckets[b];
+    for (; prog; prog = prog->next) {
+        if (prog->array == a and prog->index == index)
+            return prog->compiled ? prog : nullptr;
+    }
+
+    prog = ALLOC(struct Reb_Parse_Program);
+    prog->array = a;
+    prog->index = index;
+    Compile_Parse_Program(prog);
+
+    if (not prog->compiled and prog->steps) {  // only need the verdict
+        FREE_N(struct Reb_Parse_Step, prog->capacity, prog->steps);
+        prog->steps = nullptr;
+    }
+
+    prog->next = PG_Parse_Buckets[b];
+    PG_Parse_Buckets[b] = prog;
+    SET_ARRAY_FLAG(a, PARSE_COMPILED);
+
+    if (++PG_Parse_Num_Programs > PG_Parse_Num_Buckets * 2)
+        Expand_Parse_Buckets();
+
+    return prog->compiled ? prog : nullptr;
+}
+
+
+// A program which bailed at runtime is not tried again (until the array is
+// modified and it gets recompiled).
+//
+static void Mark_Parse_Program_Bailed(struct Reb_Parse_Program *prog) {
+    prog->compiled = false;
+    FREE_N(struct Reb_Parse_Step, prog->capacity, prog->steps);
+    prog->steps = nullptr;
+}
+
+
+//
+//  Forget_Parse_Programs: C
+//
+// Free the compiled PARSE programs for an array, because its rules are about
+// to be modified or the array is going away.
+//
+void Forget_Parse_Programs(REBARR *a)
+{
+    CLEAR_ARRAY_FLAG(a, PARSE_COMPILED);
+    ++PG_Parse_Epoch;  // invalidates PARSE/MEMO results (see below)
+
+    if (not PG_Parse_Buckets)
+        return;  // before Startup_Parse() or after Shutdown_Parse()
+
+    struct Reb_Parse_Program **link = &PG_Parse_Buckets[
+        Parse_Bucket(a, PG_Parse_Num_Buckets)
+    ];
+    while (*link) {
+        struct Reb_Parse_Program *prog = *link;
+        if (prog->array == a) {
+            *link = prog->next;
+            Free_Parse_Program(prog);
+        }
+        else
+            link = &prog->next;
+    }
+}
+
+
+//
+//  Startup_Parse: C
+//
+void Startup_Parse(void)
+{
+    PG_Parse_Num_Buckets = PARSE_MIN_BUCKETS;
+    PG_Parse_Buckets = ALLOC_N_ZEROFILL(
+        struct Reb_Parse_Program*, PG_Parse_Num_Buckets
+    );
+    PG_Parse_Num_Programs = 0;
+}
+
+
+//
+//  Shutdown_Parse: C
+//
+// The shutdown recycle has decayed all the arrays, so there should not be
+// any programs left (unless an unmanaged array was leaked).
+//
+void Shutdown_Parse(void)
+{
+    REBLEN n;
+    for (n = 0; n < PG_Parse_Num_Buckets; ++n) {
+        while (PG_Parse_Buckets[n]) {
+            struct Reb_Parse_Program *prog = PG_Parse_Buckets[n];
+            PG_Parse_Buckets[n] = prog->next;
+            Free_Parse_Program(prog);
+        }
+    }
+    assert(PG_Parse_Num_Programs == 0);
+
+    FREE_N(
+        struct Reb_Parse_Program*, PG_Parse_Num_Buckets, PG_Parse_Buckets
+    );
+    PG_Parse_Buckets = nullptr;
+    PG_Parse_Num_Buckets = 0;
+}
+
+
+//=//// PACKRAT MEMOIZATION (PARSE/MEMO) //////////////////////////////////=//
+//
+// Grammars that backtrack with `|` can try the same block rule at the same
+// input position over and over, taking exponential time.  PARSE/MEMO keeps
+// a table of (block, specifier, input, position) => result for block rules,
+// so each is only tried once per position (a "packrat" parser).
+//
+// The table has a fixed number of entries, chosen from the memory budget,
+// and a new result simply replaces whatever was in its slot.  So memory is
+// bounded, at the cost of recomputing results that were evicted.
+//
+// Results are only valid while the rules and input stay the same.  Entries
+// carry the generation of the memo they were made in, and the generation
+// is bumped when PARSE's own REMOVE, INSERT, or CHANGE modify the input,
+// after any GROUP! (or other code in the rules) runs, since it may modify
+// the input too, or when any array with compiled programs is modified or
+// freed (memoized rule arrays are flagged like compiled ones, see
+// Forget_Parse_Programs()).
+// As with any packrat parser, a hit does not rerun what's inside the block:
+// GROUP!s, SET, and COPY in memoized rules only happen on the first try.
+// Nothing is memoized while a COLLECT is in effect, as KEEPs would be lost.
+//
+
+struct Reb_Parse_Memo_Entry {
+    REBARR *array;  // nullptr if the entry was never used
+    REBLEN index;
+    REBSPC *specifier;
+    REBSER *input;
+    REBLEN pos;
+    REBLEN generation;
+    REBIXO result;  // END_FLAG if the rule did not match
+};
+
+struct Reb_Parse_Memo {
+    REBLEN num_entries;  // power of 2
+    REBLEN generation;
+    REBLEN epoch;  // PG_Parse_Epoch when generation was last checked
+    struct Reb_Parse_Memo_Entry *entries;  // allocated after this struct
+};
+
+#define PARSE_MEMO_DEFAULT_BUDGET (1 << 20)  // bytes
+
+inline static struct Reb_Parse_Memo *VAL_PARSE_MEMO(const RELVAL *v) {
+    if (IS_BLANK(v))
+        return nullptr;
+    return VAL_HANDLE_POINTER(struct Reb_Parse_Memo, v);
+}
+
+static void Cleanup_Parse_Memo(const REBVAL *v) {
+    Free_Mem(VAL_HANDLE_VOID_POINTER(v), VAL_HANDLE_LEN(v));
+}
+
+// Make a memo table taking up no more than `budget` bytes (but at least a
+// minimal table), as a HANDLE! that frees it when it is GC'd.
+//
+static REBVAL *Init_Parse_Memo(RELVAL *out, REBI64 budget) {
+    REBLEN num_entries = 16;
+    while (
+        cast(REBI64, sizeof(struct Reb_Parse_Memo)
+            + sizeof(struct Reb_Parse_Memo_Entry) * num_entries * 2
+        ) <= budget
+        and num_entries < (1u << 30)
+    ){
+        num_entries *= 2;
+    }
+
+    REBLEN size = sizeof(struct Reb_Parse_Memo)
+        + sizeof(struct Reb_Parse_Memo_Entry) * num_entries;
+    struct Reb_Parse_Memo *memo = cast(
+        struct Reb_Parse_Memo*, Alloc_Mem(size)
+    );
+    memo->num_entries = num_entries;
+    memo->generation = 1;  // so zeroed entries never match
+    memo->epoch = PG_Parse_Epoch;
+    memo->entries = cast(struct Reb_Parse_Memo_Entry*, memo + 1);
+    memset(
+        memo->entries, 0, sizeof(struct Reb_Parse_Memo_Entry) * num_entries
+    );
+
+    ++PG_Parse_Stats.Memo_Parses;
+    return Init_Handle_Cdata_Managed(out, memo, size, &Cleanup_Parse_Memo);
+}
+
+inline static void Invalidate_Parse_Memo(struct Reb_Parse_Memo *memo) {
+    if (memo)
+        ++memo->generation;
+}
+
+// Find the slot for a block rule at an input position, and say whether it
+// holds a result for it.  The key is written into `key` either way, so the
+// result can be stored there with Store_Parse_Memo() after a miss.
+//
+static struct Reb_Parse_Memo_Entry *Lookup_Parse_Memo(
+    bool *hit,
+    struct Reb_Parse_Memo_Entry *key,
+    struct Reb_Parse_Memo *memo,
+    const RELVAL *block,
+    REBSPC *specifier,
+    REBSER *input,
+    REBLEN pos
+){
+    if (memo->epoch != PG_Parse_Epoch) {  // some rule array was changed
+        memo->epoch = PG_Parse_Epoch;
+        ++memo->generation;
+    }
+
+    key->array = VAL_ARRAY(block);
+    key->index = VAL_INDEX(block);
+    key->specifier = specifier;
+    key->input = input;
+    key->pos = pos;
+    key->generation = memo->generation;
+
+    uintptr_t h = cast(uintptr_t, key->array) >> 4;
+    h ^= cast(uintptr_t, key->input) >> 6;
+    h ^= cast(uintptr_t, key->specifier) >> 8;
+    h = h * 31 + key->index;
+    h = h * 2654435761u + pos;
+    h ^= h >> 15;
+
+    struct Reb_Parse_Memo_Entry *slot
+        = &memo->entries[h & (memo->num_entries - 1)];
+
+    ++PG_Parse_Stats.Memo_Lookups;
+    *hit = (
+        slot->array == key->array
+        and slot->index == key->index
+        and slot->pos == key->pos
+        and slot->input == key->input
+        and slot->specifier == key->specifier
+        and slot->generation == key->generation
+        and (slot->result == END_FLAG or slot->result <= SER_LEN(input))
+    );
+    if (*hit)
+        ++PG_Parse_Stats.Memo_Hits;
+    return slot;
+}
+
+static void Store_Parse_Memo(
+    struct Reb_Parse_Memo_Entry *slot,
+    struct Reb_Parse_Memo_Entry *key,
+    REBIXO result
+){
+    assert(result != THROWN_FLAG and result != BAIL_FLAG);
+
+    if (not Is_Parse_Compilable_Array(key->array))
+        return;  // can't flag it to learn when it is modified or freed
+    SET_ARRAY_FLAG(key->array, PARSE_COMPILED);
+
+    if (slot->array and slot->generation == key->generation)
+        ++PG_Parse_Stats.Memo_Evictions;
+    ++PG_Parse_Stats.Memo_Stores;
+
+    *slot = *key;
+    slot->result = result;
+}
+
+
+// Input state for running compiled programs.  For strings, the byte position
+// of the last character read is kept so that matching characters in order
+// doesn't have to seek with STR_AT() each time.
+//
+struct Reb_Parse_Run {
+    REBVAL *out;  // receives thrown value if signal processing throws
+    struct Reb_Parse_Memo *memo;  // nullptr unless PARSE/MEMO
+    REBVAL *input;  // index is updated for Find_In_Any_Sequence()
+    REBSER *series;
+    bool is_binary;
+    REBFLGS find_flags;
+    bool has_case;
+    REBLEN len;
+    REBLEN cursor_index;  // index of character at cursor_bp
+    const REBYTE *cursor_bp;
+};
+
+inline static REBUNI Parse_Char_At(struct Reb_Parse_Run *run, REBLEN pos) {
+    assert(pos < run->len);
+    if (run->is_binary)
+        return *BIN_AT(run->series, pos);
+
+    REBCHR(const*) cp;
+    if (pos == run->cursor_index)
+        cp = cast(REBCHR(const*), run->cursor_bp);
+    else
+        cp = STR_AT(STR(run->series), pos);
+
+    REBUNI c;
+    cp = NEXT_CHR(&c, cp);
+    run->cursor_index = pos + 1;
+    run->cursor_bp = cp;
+    return c;
+}
+
+static REBIXO Run_Parse_Program(
+    struct Reb_Parse_Run *run,
+    struct Reb_Parse_Program *prog,
+    REBSPC *specifier,
+    REBLEN pos
+);
+
+
+// Run signals (GC slices, Ctrl-C...) when the evaluator's countdown runs out,
+// as the interpreter would between steps.  A signal handler can modify or
+// free arrays, and Forget_Parse_Programs() could free the programs running
+// on the C stack.  Since any forgetting bumps PG_Parse_Epoch, a change in it
+// makes the whole compiled parse bail without touching its programs again
+// (see Subparse_Compiled()).  Bails also if the input was shortened to end
+// before `pos`.  Otherwise gives back `pos`.
+//
+static REBIXO Do_Parse_Signals(struct Reb_Parse_Run *run, REBLEN pos)
+{
+    REBLEN epoch = PG_Parse_Epoch;
+    if (Do_Signals_Throws(SET_END(run->out)))
+        return THROWN_FLAG;
+
+    if (PG_Parse_Epoch != epoch)
+        return BAIL_FLAG;
+
+    run->len = SER_LEN(run->series);  // signal code could change it
+    run->cursor_index = NOT_FOUND;
+    if (pos > run->len)
+        return BAIL_FLAG;
+
+    return pos;
+}
+
+
+// Match a rule once at `pos`, giving the position after it or END_FLAG.
+// This is the subset of Parse_One_Rule() (and the SKIP and END commands)
+// which compiled programs use.
+//
+static REBIXO Match_Parse_Op(
+    struct Reb_Parse_Run *run,
+    enum Reb_Parse_Op op,
+    const RELVAL *rule,
+    REBSPC *specifier,
+    REBLEN pos
+){
+    switch (op) {
+      case PARSE_OP_SKIP:
+        return pos < run->len ? pos + 1 : END_FLAG;
+
+      case PARSE_OP_END:
+        return pos < run->len ? END_FLAG : run->len;
+
+      case PARSE_OP_BLOCK: {
+        if (VAL_INDEX(rule) > VAL_LEN_HEAD(rule))
+            return BAIL_FLAG;
+
+        struct Reb_Parse_Program *sub = Get_Parse_Program(
+            VAL_ARRAY(rule),
+            VAL_INDEX(rule)
+        );
+        if (not sub)
+            return BAIL_FLAG;
+
+        if (not run->memo)
+            return Run_Parse_Program(run, sub, specifier, pos);
+
+        bool hit;
+        struct Reb_Parse_Memo_Entry key;
+        struct Reb_Parse_Memo_Entry *slot = Lookup_Parse_Memo(
+            &hit, &key, run->memo, rule, specifier, run->series, pos
+        );
+        if (hit)
+            return slot->result;
+
+        REBIXO i = Run_Parse_Program(run, sub, specifier, pos);
+        if (i != THROWN_FLAG and i != BAIL_FLAG)
+            Store_Parse_Memo(slot, &key, i);
+        return i; }
+
+      default:
+        break;
+    }
+
+    if (pos == run->len)  // only blocks can match at the end, see above
+        return END_FLAG;
+
+    switch (op) {
+      case PARSE_OP_CHAR:
+        if (run->is_binary) {
+            REBSIZ size = VAL_CHAR_ENCODED_SIZE(rule);
+            if (pos + size > run->len)
+                return END_FLAG;
+            if (0 != memcmp(
+                BIN_AT(run->series, pos), VAL_CHAR_ENCODED(rule), size
+            )){
+                return END_FLAG;
+            }
+            return pos + size;
+        }
+        else {
+            REBUNI c = Parse_Char_At(run, pos);
+            if (run->has_case) {
+                if (c != VAL_CHAR(rule))
+                    return END_FLAG;
+            }
+            else if (UP_CASE(c) != UP_CASE(VAL_CHAR(rule)))
+                return END_FLAG;
+            return pos + 1;
+        }
+
+      case PARSE_OP_SEQUENCE: {
+        VAL_INDEX(run->input) = pos;
+
+        REBLEN len;
+        REBLEN index = Find_In_Any_Sequence(
+            &len,
+            run->input,
+            rule,
+            run->find_flags | AM_FIND_MATCH
+        );
+        if (index == NOT_FOUND)
+            return END_FLAG;
+        return index + len; }
+
+      case PARSE_OP_BITSET: {
+        REBUNI c = Parse_Char_At(run, pos);
+        if (Check_Bit(VAL_BITSET(rule), c, not run->has_case))
+            return pos + 1;
+        return END_FLAG; }
+
+      default:
+        assert(false);
+        return BAIL_FLAG;
+    }
+}
+
+
+// Run one step, including its repetition.  This mirrors the "iterated rule
+// processing section" of SUBPARSE.
+//
+static REBIXO Run_Parse_Step(
+    struct Reb_Parse_Run *run,
+    struct Reb_Parse_Program *prog,
+    struct Reb_Parse_Step *step,
+    REBSPC *specifier,
+    REBLEN pos
+){
+    const RELVAL *rule = ARR_AT(prog->array, step->index);
+    enum Reb_Parse_Op op = step->op;
+
+    DECLARE_LOCAL (save);
+    if (op == PARSE_OP_WORD) {
+        const REBVAL *var = Try_Get_Opt_Var(rule, specifier);
+        if (not var)
+            return BAIL_FLAG;  // interpreter raises the error
+
+        switch (VAL_TYPE(var)) {
+          case REB_CHAR:
+            if (VAL_CHAR(var) == 0)
+                return BAIL_FLAG;
+            op = PARSE_OP_CHAR;
+            break;
+
+          case REB_TEXT:
+          case REB_BINARY:
+          case REB_TAG:
+          case REB_FILE:
+          case REB_EMAIL:
+            op = PARSE_OP_SEQUENCE;
+            break;
+
+          case REB_BITSET:
+            op = PARSE_OP_BITSET;
+            break;
+
+          case REB_BLOCK:
+            op = PARSE_OP_BLOCK;
+            break;
+
+          default:  // includes null, and things like WORD! or INTEGER!
+            return BAIL_FLAG;
+        }
+
+        Move_Value(save, var);  // variable could move if a block runs code
+        rule = save;
+    }
+
+    if (op == PARSE_OP_BITSET and step->maxcount > 1) {  // see SUBPARSE
+        const REBYTE *bp;
+        const REBYTE *ep;
+        if (run->is_binary) {
+            bp = BIN_AT(run->series, pos);
+            ep = BIN_TAIL(run->series);
+        }
+        else {
+            if (pos == run->cursor_index)
+                bp = run->cursor_bp;
+            else
+                bp = STR_AT(STR(run->series), pos);
+            ep = STR_TAIL(STR(run->series));
+        }
+        REBLEN n = Span_Bitset(
+            &bp,
+            ep,
+            cast(REBLEN, step->maxcount),
+            VAL_BITSET(rule),
+            not run->has_case,
+            run->is_binary
+        );
+        if (cast(REBINT, n) < step->mincount)
+            return END_FLAG;
+
+        if (not run->is_binary) {
+            run->cursor_index = pos + n;
+            run->cursor_bp = bp;
+        }
+        return pos + n;
+    }
+
+    REBINT count = 0;
+    while (count < step->maxcount) {
+        if (count != 0) {  // Run_Parse_Program() counted the first match
+            assert(Eval_Count >= 0);
+            if (--Eval_Count == 0) {
+                REBIXO i = Do_Parse_Signals(run, pos);
+                if (i == THROWN_FLAG or i == BAIL_FLAG)
+                    return i;
+            }
+        }
+
+        REBIXO i = Match_Parse_Op(run, op, rule, specifier, pos);
+        if (i == THROWN_FLAG or i == BAIL_FLAG)
+            return i;
+
+        if (i == END_FLAG) {
+            if (count < step->mincount)
+                return END_FLAG;  // number of matches was not enough
+            break;
+        }
+
+        count++;  // may overflow to negative
+        if (count < 0)
+            count = INT32_MAX;  // the forever case
+
+        pos = i;
+        if (i == run->len and step->any_or_some)
+            break;  // see notes on ANY and SOME in SUBPARSE
+    }
+
+    return pos;
+}
+
+
+// Run a program from `pos`, giving the position reached, END_FLAG if none of
+// the alternates matched, THROWN_FLAG if signal processing threw, or
+// BAIL_FLAG if the rules must be run by the interpreter.
+//
+static REBIXO Run_Parse_Program(
+    struct Reb_Parse_Run *run,
+    struct Reb_Parse_Program *prog,
+    REBSPC *specifier,
+    REBLEN pos
+){
+    if (C_STACK_OVERFLOWING(&pos))
+        return BAIL_FLAG;  // interpreter will give the stack overflow error
+
+    if (ARR_LEN(prog->array) != prog->len)
+        return BAIL_FLAG;  // modified without going through a write check
+
+    REBLEN start = pos;
+    REBLEN n = 0;
+    while (n < prog->num_steps) {
+        struct Reb_Parse_Step *step = &prog->steps[n];
+        if (step->op == PARSE_OP_ALT)
+            return pos;  // reached `|` without a match failure
+
+        assert(Eval_Count >= 0);
+        if (--Eval_Count == 0) {
+            REBIXO i = Do_Parse_Signals(run, pos);
+            if (i == THROWN_FLAG or i == BAIL_FLAG)
+                return i;
+        }
+
+        REBIXO i = Run_Parse_Step(run, prog, step, specifier, pos);
+        if (i == THROWN_FLAG or i == BAIL_FLAG)
+            return i;
+
+        if (i == END_FLAG) {  // go to the next alternate
+            n = step->next_alt;
+            if (n == prog->num_steps)
+                return END_FLAG;
+            ++n;  // skip the `|`
+            pos = start;
+            continue;
+        }
+
+        pos = i;
+        ++n;
+    }
+
+    return pos;
+}
+
+
+// Try to run rules as a compiled program, for a Subparse_Throws() call which
+// would be matching the whole block.  Returns BAIL_FLAG if the interpreter
+// is needed.
+//
+static REBIXO Subparse_Compiled(
+    REBVAL *out,
+    const RELVAL *input,
+    REBSPC *input_specifier,
+    struct Reb_Feed *rules_feed,
+    const REBVAL *memo,
+    REBFLGS flags
+){
+    if (flags & PF_ONE_RULE)
+        return BAIL_FLAG;
+
+    if (Trace_Level)
+        return BAIL_FLAG;
+
+    enum Reb_Kind kind = VAL_TYPE(input);  // QUOTED! input is interpreted
+    if (kind != REB_BINARY and not ANY_STRING_KIND(kind))
+        return BAIL_FLAG;
+
+    REBARR *a = rules_feed->array;
+    if (not a or rules_feed->vaptr)
+        return BAIL_FLAG;
+
+    REBLEN index = rules_feed->index - 1;  // feed index is of the *next* cell
+    if (index > ARR_LEN(a) or rules_feed->value != ARR_AT(a, index))
+        return BAIL_FLAG;
+
+    struct Reb_Parse_Program *prog = Get_Parse_Program(a, index);
+    if (not prog)
+        return BAIL_FLAG;
+
+    DECLARE_LOCAL (input_copy);
+    Derelativize(input_copy, input, input_specifier);
+    if (VAL_INDEX(input_copy) > VAL_LEN_HEAD(input_copy))
+        VAL_INDEX(input_copy) = VAL_LEN_HEAD(input_copy);
+
+    struct Reb_Parse_Run run;
+    run.out = out;
+    run.memo = VAL_PARSE_MEMO(memo);
+    run.input = input_copy;
+    run.series = VAL_SERIES(input_copy);
+    run.is_binary = (kind == REB_BINARY);
+    run.find_flags = flags;
+    run.has_case = did (flags & AM_FIND_CASE);
+    run.len = SER_LEN(run.series);
+    run.cursor_index = NOT_FOUND;
+    run.cursor_bp = nullptr;
+
+    REBLEN epoch = PG_Parse_Epoch;
+    REBIXO i = Run_Parse_Program(
+        &run,
+        prog,
+        rules_feed->specifier,
+        VAL_INDEX(input_copy)
+    );
+
+    // If signal handlers forgot any programs, `prog` may have been freed
+    // (and this bail wasn't the program's fault anyway).
+    //
+    if (i == BAIL_FLAG and PG_Parse_Epoch == epoch)
+        Mark_Parse_Program_Bailed(prog);
+
+    return i;
+}
+
+
 // Subparse_Throws() is a helper that sets up a call frame and invokes the
 // SUBPARSE native--which represents one level of PARSE recursion.
 //
@@ -201,10 +1153,25 @@ static bool Subparse_Throws(
     REBSPC *input_specifier,
     struct Reb_Feed *rules_feed,
     REBARR *opt_collection,
+    const REBVAL *memo,  // BLANK! unless PARSE/MEMO, else a HANDLE!
     REBFLGS flags
 ){
     assert(ANY_SERIES_KIND(CELL_KIND(VAL_UNESCAPED(input))));
 
+    REBIXO compiled = Subparse_Compiled(
+        out, input, input_specifier, rules_feed, memo, flags
+    );
+    if (compiled != BAIL_FLAG) {
+        *interrupted_out = false;
+        if (compiled == THROWN_FLAG)
+            return true;
+        if (compiled == END_FLAG)
+            Init_Nulled(out);
+        else
+            Init_Integer(out, compiled);
+        return false;
+    }
+
     DECLARE_FRAME (f, rules_feed, EVAL_MASK_DEFAULT);
 
     Push_Frame(out, f);  // checks for C stack overflow
@@ -236,12 +1203,14 @@ static bool Subparse_Throws(
         collect_tail = 0;
     }
 
+    Move_Value(Prep_Stack_Cell(P_MEMO_VALUE), memo);
+
     // Need to track NUM-QUOTES somewhere that it can be read from the frame
     //
     Init_Nulled(Prep_Stack_Cell(P_NUM_QUOTES_VALUE));
 
-    assert(ACT_NUM_PARAMS(NAT_ACTION(subparse)) == 5); // checks RETURN:
-    Init_Nulled(Prep_Stack_Cell(f->rootvar + 5));
+    assert(ACT_NUM_PARAMS(NAT_ACTION(subparse)) == 6); // checks RETURN:
+    Init_Nulled(Prep_Stack_Cell(f->rootvar + 6));
 
     // !!! By calling the subparse native here directly from its C function
     // vs. going through the evaluator, we don't get the opportunity to do
@@ -430,6 +1399,8 @@ REB_R Process_Group_For_Parse(
     if (Do_Any_Array_At_Throws(cell, group, derived))
         return R_THROWN;
 
+    Invalidate_Parse_Memo(P_MEMO);  // the code may have changed the input
+
     // !!! The input is not locked from modification by agents other than the
     // PARSE's own REMOVE/etc.  This is a sketchy idea, but as long as it's
     // allowed, each time arbitrary user code runs, rules have to be adjusted
@@ -533,6 +1504,7 @@ static REB_R Parse_One_Rule(
             SPECIFIED,
             subfeed,
             P_COLLECTION,
+            P_MEMO_VALUE,
             P_FIND_FLAGS & ~PF_ONE_RULE
         )){
             Move_Value(P_OUT, subresult);
@@ -1128,6 +2100,7 @@ static REBIXO Do_Eval_Rule(REBFRM *f)
             Move_Value(P_OUT, P_CELL);  // BREAK/RETURN/QUIT/THROW...
             return THROWN_FLAG;
         }
+        Invalidate_Parse_Memo(P_MEMO);  // evaluation may change the input
 
         // !!! This copies a single value into a block to use as data, because
         // parse input is matched as a series.  Can this be avoided?
@@ -1305,6 +2278,8 @@ static REB_R Handle_Seek_Rule_Dont_Update_Begin(
 //      find-flags [integer!]
 //      collection "Array into which any KEEP values are collected"
 //          [blank! any-series!]
+//      memo "Packrat cache of block rule results, if PARSE/MEMO"
+//          [blank! handle!]
 //      <local> num-quotes
 //  ]
 //
@@ -1341,6 +2316,7 @@ REBNATIVE(subparse)
 
     UNUSED(ARG(input));  // used via P_INPUT
     UNUSED(ARG(find_flags));  // used via P_FIND_FLAGS
+    UNUSED(ARG(memo));  // used via P_MEMO
     UNUSED(ARG(num_quotes));  // used via P_NUM_QUOTES_VALUE
 
     REBFRM *f = frame_; // nice alias of implicit native parameter
@@ -1599,6 +2575,7 @@ REBNATIVE(subparse)
                         SPECIFIED,
                         f->feed,
                         collection,
+                        P_MEMO_VALUE,
                         P_FIND_FLAGS | PF_ONE_RULE
                     );
 
@@ -1702,6 +2679,7 @@ REBNATIVE(subparse)
                             SPECIFIED,
                             f->feed,
                             P_COLLECTION,
+                            P_MEMO_VALUE,
                             P_FIND_FLAGS | PF_ONE_RULE
                         );
 
@@ -1830,6 +2808,7 @@ REBNATIVE(subparse)
                         Move_Value(P_OUT, condition);
                         return R_THROWN;
                     }
+                    Invalidate_Parse_Memo(P_MEMO);  // may change input
 
                     FETCH_NEXT_RULE(f);
 
@@ -2039,6 +3018,42 @@ REBNATIVE(subparse)
 
         REBINT count; // gotos would cross initialization
         count = 0;
+
+        if (
+            IS_BITSET(rule)
+            and maxcount > 1
+            and not IS_SER_ARRAY(P_INPUT)
+            and not Trace_Level  // tracing shows each match
+        ){
+            // A repeated charset (e.g. `some alpha`) keeps no state between
+            // matches, so the run can be scanned all at once.  The span ends
+            // at the tail, which is where ANY and SOME would stop anyway.
+            //
+            const REBYTE *bp;
+            const REBYTE *ep;
+            if (P_TYPE == REB_BINARY) {
+                bp = BIN_AT(P_INPUT, P_POS);
+                ep = BIN_TAIL(P_INPUT);
+            }
+            else {
+                bp = STR_AT(STR(P_INPUT), P_POS);
+                ep = STR_TAIL(STR(P_INPUT));
+            }
+            count = cast(REBINT, Span_Bitset(
+                &bp,
+                ep,
+                cast(REBLEN, maxcount),
+                VAL_BITSET(rule),
+                not P_HAS_CASE,
+                P_TYPE == REB_BINARY
+            ));
+            if (count < mincount)
+                P_POS = NOT_FOUND;
+            else
+                P_POS += count;
+            goto post_match_processing;
+        }
+
         while (count < maxcount) {
             assert(
                 not IS_BAR(rule)
@@ -2227,6 +3242,7 @@ REBNATIVE(subparse)
                         P_INPUT_SPECIFIER,  // harmless if specified API value
                         subrules_feed,
                         P_COLLECTION,
+                        P_MEMO_VALUE,
                         P_FIND_FLAGS
                     )){
                         return R_THROWN;
@@ -2276,43 +3292,68 @@ REBNATIVE(subparse)
                 }
             }
             else if (IS_BLOCK(rule)) {  // word fetched block, or inline block
+                //
+                // With PARSE/MEMO, a block that was tried at this position
+                // before gives the same answer (see PACKRAT MEMOIZATION)
+                //
+                struct Reb_Parse_Memo *memo = P_COLLECTION
+                    ? nullptr
+                    : P_MEMO;
+                struct Reb_Parse_Memo_Entry key;
+                struct Reb_Parse_Memo_Entry *slot = nullptr;
+                bool hit = false;
+                if (memo) {
+                    slot = Lookup_Parse_Memo(
+                        &hit, &key, memo,
+                        rule, P_RULE_SPECIFIER,
+                        P_INPUT, P_POS
+                    );
+                }
 
-                DECLARE_ARRAY_FEED (subrules_feed,
-                    VAL_ARRAY(rule),
-                    VAL_INDEX(rule),
-                    P_RULE_SPECIFIER
-                );
+                if (hit)
+                    i = slot->result;
+                else {
+                    DECLARE_ARRAY_FEED (subrules_feed,
+                        VAL_ARRAY(rule),
+                        VAL_INDEX(rule),
+                        P_RULE_SPECIFIER
+                    );
 
-                bool interrupted;
-                if (Subparse_Throws(
-                    &interrupted,
-                    SET_END(P_CELL),
-                    P_INPUT_VALUE,
-                    SPECIFIED,
-                    subrules_feed,
-                    P_COLLECTION,
-                    P_FIND_FLAGS & ~(PF_ONE_RULE)
-                )) {
-                    Move_Value(P_OUT, P_CELL);
-                    return R_THROWN;
-                }
+                    bool interrupted;
+                    if (Subparse_Throws(
+                        &interrupted,
+                        SET_END(P_CELL),
+                        P_INPUT_VALUE,
+                        SPECIFIED,
+                        subrules_feed,
+                        P_COLLECTION,
+                        P_MEMO_VALUE,
+                        P_FIND_FLAGS & ~(PF_ONE_RULE)
+                    )) {
+                        Move_Value(P_OUT, P_CELL);
+                        return R_THROWN;
+                    }
 
-                // Non-breaking out of loop instances of match or not.
+                    // Non-breaking out of loop instances of match or not.
 
-                if (IS_NULLED(P_CELL))
-                    i = END_FLAG;
-                else {
-                    assert(IS_INTEGER(P_CELL));
-                    i = VAL_INT32(P_CELL);
-                }
+                    if (IS_NULLED(P_CELL))
+                        i = END_FLAG;
+                    else {
+                        assert(IS_INTEGER(P_CELL));
+                        i = VAL_INT32(P_CELL);
+                    }
 
-                if (interrupted) { // ACCEPT or REJECT ran
-                    assert(i != THROWN_FLAG);
-                    if (i == END_FLAG)
-                        P_POS = NOT_FOUND;
-                    else
-                        P_POS = cast(REBLEN, i);
-                    break;
+                    if (interrupted) { // ACCEPT or REJECT ran
+                        assert(i != THROWN_FLAG);
+                        if (i == END_FLAG)
+                            P_POS = NOT_FOUND;
+                        else
+                            P_POS = cast(REBLEN, i);
+                        break;
+                    }
+
+                    if (slot)
+                        Store_Parse_Memo(slot, &key, i);
                 }
             }
             else {
@@ -2472,6 +3513,7 @@ REBNATIVE(subparse)
                             Move_Value(P_OUT, P_CELL);
                             return R_THROWN;
                         }
+                        Invalidate_Parse_Memo(P_MEMO);  // may change input
 
                         // !!! What SET-GROUP! can do in PARSE is more
                         // ambitious than just an indirection for naming
@@ -2531,6 +3573,7 @@ REBNATIVE(subparse)
 
                 if (flags & PF_REMOVE) {
                     FAIL_IF_READ_ONLY(P_INPUT_VALUE);
+                    Invalidate_Parse_Memo(P_MEMO);  // positions shift
                     if (count)
                         Remove_Series_Len(P_INPUT, begin, count);
                     P_POS = begin;
@@ -2538,6 +3581,7 @@ REBNATIVE(subparse)
 
                 if (flags & (PF_INSERT | PF_CHANGE)) {
                     FAIL_IF_READ_ONLY(P_INPUT_VALUE);
+                    Invalidate_Parse_Memo(P_MEMO);  // positions shift
                     count = (flags & PF_INSERT) ? 0 : count;
                     bool only = false;
 
@@ -2691,6 +3735,9 @@ REBNATIVE(subparse)
 //      rules "Rules to parse by"
 //          [<blank> block!]
 //      /case "Uses case-sensitive comparison"
+//      /memo "Cache results of block rules by position (packrat parsing)"
+//      /budget "Most bytes the /MEMO cache may use (implies /MEMO)"
+//          [integer!]
 //  ]
 //
 REBNATIVE(parse)
@@ -2712,6 +3759,19 @@ REBNATIVE(parse)
         VAL_SPECIFIER(ARG(rules))
     );
 
+    // The memo table is a HANDLE! which the GC frees, so it is not leaked if
+    // the parse fails.  The spare cell keeps it alive until we are done.
+    //
+    if (REF(budget)) {
+        if (VAL_INT64(ARG(budget)) <= 0)
+            fail (PAR(budget));
+        Init_Parse_Memo(D_SPARE, VAL_INT64(ARG(budget)));
+    }
+    else if (REF(memo))
+        Init_Parse_Memo(D_SPARE, PARSE_MEMO_DEFAULT_BUDGET);
+    else
+        Init_Blank(D_SPARE);
+
     bool interrupted;
     if (Subparse_Throws(
         &interrupted,
@@ -2719,6 +3779,7 @@ REBNATIVE(parse)
         ARG(input), SPECIFIED,
         rules_feed,
         nullptr,  // start out with no COLLECT in effect, so no P_COLLECTION
+        D_SPARE,
         REF(case) ? AM_FIND_CASE : 0
         //
         // We always want "case-sensitivity" on binary bytes, vs. treating
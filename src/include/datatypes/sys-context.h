@@ -91,6 +91,22 @@
     ARRAY_FLAG_23
 
 
+//=//// SERIES_FLAG_VARLIST_IN_ARENA //////////////////////////////////////=//
+//
+// The data of a frame's varlist lives in the frame arena and not in a memory
+// pool or malloc() allocation, so it must go back with Free_Arena_Cells().
+// (A varlist waiting in TG_Reuse may also have this flag with no data.)
+//
+#define SERIES_FLAG_VARLIST_IN_ARENA \
+    ARRAY_FLAG_24
+
+inline static bool Is_Varlist_In_Arena(REBSER *s) {
+    const uintptr_t mask =
+        ARRAY_FLAG_IS_VARLIST | SERIES_FLAG_VARLIST_IN_ARENA;
+    return (s->header.bits & mask) == mask;
+}
+
+
 #ifdef NDEBUG
     #define ASSERT_CONTEXT(c) cast(void, 0)
 #else
@@ -472,6 +488,11 @@ inline static bool Is_Native_Port_Actor(const REBVAL *actor) {
 inline static REBCTX *Steal_Context_Vars(REBCTX *c, REBNOD *keysource) {
     REBSER *stub = SER(c);
 
+    // The copy may outlive the frame that the arena cells belong to.
+    //
+    if (GET_SERIES_FLAG(stub, VARLIST_IN_ARENA))
+        Reify_Varlist_In_Arena(CTX_VARLIST(c));
+
     // Rather than memcpy() and touch up the header and info to remove
     // SERIES_INFO_HOLD put on by Enter_Native(), or NODE_FLAG_MANAGED,
     // etc.--use constant assignments and only copy the remaining fields.
@@ -200,6 +200,53 @@ inline static const char* Frame_Label_Or_Anonymous_UTF8(REBFRM *f) {
 // This privileged level of access can be used by natives that feel they can
 // optimize performance by working with the evaluator directly.
 
+// Allocate cells for a varlist from the frame arena (see Reb_Arena_Chunk).
+// If the current chunk doesn't have room, Expand_Arena() moves on to another.
+//
+inline static RELVAL *Alloc_Arena_Cells(REBLEN num_cells) {
+    size_t size = ARENA_BLOCK_HEADER + num_cells * sizeof(RELVAL);
+    if (size > cast(size_t, TG_Arena_Chunk->limit - TG_Arena_Top))
+        Expand_Arena(size);
+
+    struct Reb_Arena_Block *b = cast(struct Reb_Arena_Block*, TG_Arena_Top);
+    b->prev = TG_Arena_Last;
+    b->chunk = TG_Arena_Chunk;
+    b->freed = 0;
+
+    TG_Arena_Last = b;
+    TG_Arena_Top += size;
+    return cast(RELVAL*, cast(char*, b) + ARENA_BLOCK_HEADER);
+}
+
+inline static void Free_Arena_Cells(RELVAL *cells) {
+    struct Reb_Arena_Block *b = cast(
+        struct Reb_Arena_Block*,
+        cast(char*, cells) - ARENA_BLOCK_HEADER
+    );
+    assert(not b->freed);
+    b->freed = 1;
+
+    while (TG_Arena_Last and TG_Arena_Last->freed) {  // anything out of order
+        b = TG_Arena_Last;
+        TG_Arena_Last = b->prev;
+        TG_Arena_Chunk = b->chunk;
+        TG_Arena_Top = cast(char*, b);
+    }
+}
+
+// Give a varlist's cells back to the arena, leaving the node with no data.
+// It can go in TG_Reuse, and the next Push_Action() will give it new cells.
+//
+inline static void Free_Varlist_Arena_Cells(REBARR *varlist) {
+    REBSER *s = SER(varlist);
+    assert(GET_SERIES_FLAG(s, VARLIST_IN_ARENA));
+    if (s->content.dynamic.data) {
+        Free_Arena_Cells(cast(RELVAL*, s->content.dynamic.data));
+        s->content.dynamic.data = nullptr;
+        s->content.dynamic.rest = 0;
+    }
+}
+
 inline static void Reuse_Varlist_If_Available(REBFRM *f) {
     assert(IS_POINTER_TRASH_DEBUG(f->varlist));
     if (not TG_Reuse)
@@ -427,6 +474,8 @@ inline static void Drop_Frame_Core(REBFRM *f) {
 
     if (f->varlist) {
         assert(NOT_SERIES_FLAG(f->varlist, MANAGED));
+        if (GET_SERIES_FLAG(f->varlist, VARLIST_IN_ARENA))
+            Free_Varlist_Arena_Cells(f->varlist);  // must go in stack order
         LINK(f->varlist).reuse = TG_Reuse;
         TG_Reuse = f->varlist;
     }
@@ -569,8 +618,9 @@ inline static void Push_Action(
     f->param = ACT_PARAMS_HEAD(act); // Specializations hide some params...
     REBLEN num_args = ACT_NUM_PARAMS(act); // ...so see REB_TS_HIDDEN
 
-    // !!! Note: Should pick "smart" size when allocating varlist storage due
-    // to potential reuse--but use exact size for *this* action, for now.
+    // The cells come from the frame arena, with the exact size for *this*
+    // action.  A varlist reused from a DO of a FRAME! may have ordinary
+    // series data instead, which is used if it's big enough.
     //
     REBSER *s;
     if (not f->varlist) { // usually means first action call in the REBFRM
@@ -578,6 +628,7 @@ inline static void Push_Action(
             SERIES_MASK_VARLIST
                 | SERIES_FLAG_STACK_LIFETIME
                 | SERIES_FLAG_FIXED_SIZE // FRAME!s don't expand ATM
+                | SERIES_FLAG_VARLIST_IN_ARENA
         );
         s->info = Endlike_Header(
             FLAG_WIDE_BYTE_OR_0(0) // signals array, also implicit terminator
@@ -592,15 +643,23 @@ inline static void Push_Action(
         if (s->content.dynamic.rest >= num_args + 1 + 1) // +roovar, +end
             goto sufficient_allocation;
 
-        //assert(SER_BIAS(s) == 0);
-        Free_Unbiased_Series_Data(
-            s->content.dynamic.data,
-            SER_TOTAL(s)
-        );
+        if (GET_SERIES_FLAG(s, VARLIST_IN_ARENA))
+            Free_Varlist_Arena_Cells(f->varlist);
+        else {
+            //assert(SER_BIAS(s) == 0);
+            Free_Unbiased_Series_Data(
+                s->content.dynamic.data,
+                SER_TOTAL(s)
+            );
+            SET_SERIES_FLAG(s, VARLIST_IN_ARENA);
+        }
     }
 
-    if (not Did_Series_Data_Alloc(s, num_args + 1 + 1)) // +rootvar, +end
-        fail ("Out of memory in Push_Action()");
+    s->content.dynamic.data = cast(char*,
+        Alloc_Arena_Cells(num_args + 1 + 1) // +rootvar, +end
+    );
+    s->content.dynamic.bias = 0;
+    s->content.dynamic.rest = num_args + 1 + 1;
 
     f->rootvar = cast(REBVAL*, s->content.dynamic.data);
     f->rootvar->header.bits =
@@ -735,6 +794,12 @@ inline static void Drop_Action(REBFRM *f) {
         INIT_LINK_KEYSOURCE(f->varlist, NOD(f));
       #endif
 
+        // The cells have to outlive the frame, so they can't stay in the
+        // arena.
+        //
+        if (GET_SERIES_FLAG(f->varlist, VARLIST_IN_ARENA))
+            Reify_Varlist_In_Arena(f->varlist);
+
         INIT_LINK_KEYSOURCE(f->varlist, NOD(f->original));
         f->varlist = nullptr;
     }
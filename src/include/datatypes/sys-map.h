@@ -21,12 +21,12 @@
 //=////////////////////////////////////////////////////////////////////////=//
 //
 // Maps are implemented as a light hashing layer on top of an array.  The
-// hash indices are stored in the series node's "misc", while the values are
+// hash indices are stored in the series node's "link", while the values are
 // retained in pairs as `[key val key val key val ...]`.
 //
-// When there are too few values to warrant hashing, no hash indices are
-// made and the array is searched linearly.  This is indicated by the hashlist
-// being NULL.
+// Removing a key from a map leaves its pair in the pairlist with a null
+// value (a "zombie"), and marks its slot in the hashlist as a "tombstone".
+// Zombies are squeezed out of the pairlist when the hashlist is rebuilt.
 //
 // Though maps are not considered a series in the "ANY-SERIES!" value sense,
 // they are implemented using series--and hence are in %sys-series.h, at least
@@ -59,8 +59,118 @@ inline static REBARR *MAP_PAIRLIST(REBMAP *m) {
 #define MAP_HASHLIST(m) \
     LINK_HASHLIST(MAP_PAIRLIST(m))
 
-#define MAP_HASHES(m) \
-    SER_HEAD(MAP_HASHLIST(m))
+
+
+//=//// HASHLIST LAYOUT ///////////////////////////////////////////////////=//
+//
+// The hashlist of a MAP! (and the temporary ones made by Hash_Block() for set
+// operations) is an open-addressed table with a power-of-2 number of slots.
+// It is a byte series laid out as:
+//
+//     [Reb_Hashlist_Header] [Reb_Hash_Slot * capacity] [REBYTE * capacity]
+//
+// Each slot holds the full 32-bit hash of its key along with the 1-based
+// index of the key's record in the data array.  Keeping the hash means that
+// growing the table never has to call Hash_Value() on the keys again.
+//
+// The trailing bytes are "control bytes", one per slot.  A control byte is
+// either HASH_CTRL_EMPTY, HASH_CTRL_DELETED (a tombstone left by a removal)
+// or the low 7 bits of the slot's hash (a "fingerprint").  Lookups compare
+// a whole group of HASH_GROUP_WIDTH control bytes against the fingerprint at
+// once (with SSE2 or NEON if available), so most misses are settled without
+// ever looking at a REBVAL.
+//
+// Groups are probed starting from the one picked by the upper bits of the
+// hash, stepping by triangular numbers--which visits every group when the
+// group count is a power of 2.  A group with an EMPTY byte ends the search,
+// so the table is never allowed to fill up (see HASHLIST_MAX_LOAD()).
+//
+
+#define HASH_GROUP_WIDTH 16
+#define HASH_CTRL_EMPTY 0x80
+#define HASH_CTRL_DELETED 0xFE
+
+struct Reb_Hashlist_Header {
+    uint32_t capacity;  // number of slots, power of 2, >= HASH_GROUP_WIDTH
+    uint32_t count;  // slots with live entries
+    uint32_t deleted;  // tombstone slots
+    uint32_t zombies;  // (MAP! only) removed pairs still in the pairlist
+};
+
+struct Reb_Hash_Slot {
+    uint32_t hash;
+    uint32_t index;  // 1-based record index in the data array
+};
+
+inline static struct Reb_Hashlist_Header *HASHLIST_HEADER(REBSER *h)
+  { return cast(struct Reb_Hashlist_Header*, SER_DATA_RAW(h)); }
+
+#define HASHLIST_CAPACITY(h) \
+    HASHLIST_HEADER(h)->capacity
+
+inline static struct Reb_Hash_Slot *HASHLIST_SLOTS(REBSER *h) {
+    return cast(struct Reb_Hash_Slot*,
+        SER_DATA_RAW(h) + sizeof(struct Reb_Hashlist_Header)
+    );
+}
+
+inline static REBYTE *HASHLIST_CTRL(REBSER *h)
+  { return cast(REBYTE*, HASHLIST_SLOTS(h) + HASHLIST_CAPACITY(h)); }
+
+inline static REBSIZ Hashlist_Size(REBLEN capacity) {
+    return sizeof(struct Reb_Hashlist_Header)
+        + capacity * (sizeof(struct Reb_Hash_Slot) + 1);
+}
+
+// Keep at least 1/8 of the slots EMPTY, so probe sequences stay short and
+// are guaranteed to terminate.
+//
+#define HASHLIST_MAX_LOAD(capacity) \
+    ((capacity) - ((capacity) / 8))
+
+inline static REBLEN Hashlist_Capacity_For(REBLEN num_keys) {
+    REBLEN capacity = HASH_GROUP_WIDTH;
+    while (HASHLIST_MAX_LOAD(capacity) <= num_keys) {
+        if (capacity >= (cast(REBLEN, 1) << 30))
+            fail (Error_No_Memory(cast(REBLEN, Hashlist_Size(capacity))));
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+inline static void Init_Hashlist(REBSER *h, REBLEN capacity) {
+    assert(capacity % HASH_GROUP_WIDTH == 0);
+    assert((capacity & (capacity - 1)) == 0);  // power of 2
+
+    struct Reb_Hashlist_Header *header = HASHLIST_HEADER(h);
+    header->capacity = capacity;
+    header->count = 0;
+    header->deleted = 0;
+    header->zombies = 0;
+
+    memset(HASHLIST_CTRL(h), HASH_CTRL_EMPTY, capacity);
+    TERM_SEQUENCE_LEN(h, Hashlist_Size(capacity));
+}
+
+// Hash_Value() results are not well distributed in their low bits (e.g. an
+// INTEGER! hashes to itself), and the table uses both the low bits (for the
+// fingerprint) and high bits (for the group).  So mix them first.  This is
+// the finalizer from MurmurHash3.
+//
+inline static uint32_t Mix_Hash(uint32_t h) {
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+    return h;
+}
+
+#define HASH_FINGERPRINT(hash) \
+    cast(REBYTE, (hash) & 0x7F)
+
+#define HASH_GROUP_SEED(hash) \
+    ((hash) >> 7)
 
 inline static REBMAP *MAP(void *p) {
     REBARR *a = ARR(p);
@@ -79,15 +189,8 @@ inline static REBMAP *VAL_MAP(const REBCEL *v) {
     return MAP(a);
 }
 
+// Zombie pairs (null values) have no live slot in the hashlist, so the count
+// of live slots is the count of keys in the map.
+//
 inline static REBLEN Length_Map(REBMAP *map)
-{
-    REBVAL *v = KNOWN(ARR_HEAD(MAP_PAIRLIST(map)));
-
-    REBLEN count = 0;
-    for (; NOT_END(v); v += 2) {
-        if (not IS_NULLED(v + 1))
-            ++count;
-    }
-
-    return count;
-}
+  { return HASHLIST_HEADER(MAP_HASHLIST(map))->count; }
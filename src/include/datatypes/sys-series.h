@@ -456,6 +456,9 @@ inline static REBSER *Manage_Series(REBSER *s)
 
     s->header.bits |= NODE_FLAG_MANAGED;
 
+    if (GC_Sweeping)  // may be in a segment the sweep hasn't reached yet
+        Keep_Node_Through_Sweep(NOD(s));
+
     Untrack_Manual_Series(s);
     return s;
 }
@@ -529,6 +532,45 @@ static inline void Flip_Series_To_White(REBSER *s) {
 }
 
 
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// GENERATIONAL WRITE BARRIER
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// A minor recycle only traces from the roots and doesn't look inside of old
+// series, so if an old series is changed to refer to a young one that young
+// series would look unreachable.  Code which modifies a series must call
+// Remember_Series_Write() so the old series gets traced by the next minor
+// recycle.  This is done by FAIL_IF_READ_ONLY_SER() (which all user-facing
+// modifications go through) as well as by internal routines that mutate
+// contexts, maps, and bindings.
+//
+// The same barrier serves incremental recycles (RECYCLE/BUDGET): while one
+// is between marking slices, a series that was already marked and then gets
+// modified may now refer to series that were never marked.  So it's also
+// remembered, to be traced again before the sweep.  A marked series is also
+// remembered while a sweep is pending (RECYCLE/LAZY), because it will be old
+// once its segment is swept--even if it was young when it was written.
+//
+// Series are only marked while a recycle is in progress, so no GC state has
+// to be checked.  The common case of a young, unmarked, or already
+// remembered series is two tests.  The debug build checks for missed
+// barriers after each minor recycle, and at the end of incremental marking.
+//
+
+inline static void Remember_Series_Write(REBSER *s) {
+    if (s->info.bits & SERIES_INFO_REMEMBERED)
+        return;
+    if (
+        (s->info.bits & SERIES_INFO_OLD)
+        or (s->header.bits & NODE_FLAG_MARKED)
+    ){
+        Remember_Series(s);
+    }
+}
+
+
 //
 // Freezing and Locking
 //
@@ -550,6 +592,21 @@ inline static bool Is_Series_Read_Only(REBSER *s) { // may be temporary...
 }
 
 
+// Arrays that FIND has indexed (see %t-block.c) lose the index whenever
+// they are modified.  The flag bit is reused by paramlists, so check that.
+//
+inline static void Forget_Find_Index_If_Any(REBSER *s) {
+    if (
+        (s->header.bits & (
+            ARRAY_FLAG_FIND_INDEXED | ARRAY_FLAG_IS_PARAMLIST
+        )) == ARRAY_FLAG_FIND_INDEXED
+        and IS_SER_ARRAY(s)
+    ){
+        Forget_Find_Index(ARR(s));
+    }
+}
+
+
 // Gives the appropriate kind of error message for the reason the series is
 // read only (frozen, running, protected, locked to be a map key...)
 //
@@ -559,8 +616,19 @@ inline static bool Is_Series_Read_Only(REBSER *s) { // may be temporary...
 //
 
 inline static void FAIL_IF_READ_ONLY_SER(REBSER *s) {
-    if (not Is_Series_Read_Only(s))
+    if (not Is_Series_Read_Only(s)) {
+        Remember_Series_Write(s);  // caller is going to modify it
+        Forget_Find_Index_If_Any(s);
+        if (
+            (s->header.bits & (
+                ARRAY_FLAG_PARSE_COMPILED | ARRAY_FLAG_IS_PARAMLIST
+            )) == ARRAY_FLAG_PARSE_COMPILED
+            and IS_SER_ARRAY(s)
+        ){
+            Forget_Parse_Programs(ARR(s));  // rules may be changing
+        }
         return;
+    }
 
     if (GET_SERIES_INFO(s, AUTO_LOCKED))
         fail (Error_Series_Auto_Locked_Raw());
@@ -791,6 +859,12 @@ inline static bool Did_Series_Data_Alloc(REBSER *s, REBLEN length) {
             if (size % wide == 0)
                 CLEAR_SERIES_FLAG(s, POWER_OF_2);
         }
+        else {
+            // Alloc_Mem() may round the size up to a size class, so take
+            // whatever of that space fits whole units as capacity.
+            //
+            size = Mem_Cache_Size(size) / wide * wide;
+        }
 
         s->content.dynamic.data = ALLOC_N(char, size);
         if (not s->content.dynamic.data)
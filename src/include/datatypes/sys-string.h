@@ -37,7 +37,8 @@
 //
 // * Maintaining caches (called "Bookmarks") that map from codepoint indexes
 //   to byte offsets for larger strings.  These caches must be updated
-//   whenever the string is modified.   !!! Only one bookmark per string ATM
+//   whenever the string is modified.  Every bookmarked string remembers
+//   its last access, and long strings add a lazily built skip index.
 //
 //=//// NOTES /////////////////////////////////////////////////////////////=//
 //
@@ -484,6 +485,14 @@ inline static void TERM_STR_LEN_SIZE(REBSTR *s, REBLEN len, REBSIZ used) {
 // A "bookmark" in this terminology is simply a small REBSER-sized node which
 // holds a mapping from an index to an offset in a string.  It is pointed to
 // by the string's LINK() field in the series node.
+//
+// That one mapping tracks the last access, which makes iteration cheap but
+// does nothing for random access.  So a string of at least BMK_SKIP_MIN_LEN
+// codepoints also gets a "skip index" hung off the bookmark's MISC(): the
+// byte offsets of codepoints 0, BMK_SKIP_STRIDE, 2 * BMK_SKIP_STRIDE...
+// It's only filled in as far as accesses have reached, and a modification
+// at an index only drops the entries after it (the ones at or before it
+// still map the same codepoints to the same bytes).
 
 #define BMK_INDEX(b) \
     PAYLOAD(Bookmark, ARR_SINGLE(b)).index
@@ -491,6 +500,20 @@ inline static void TERM_STR_LEN_SIZE(REBSTR *s, REBLEN len, REBSIZ used) {
 #define BMK_OFFSET(b) \
     PAYLOAD(Bookmark, ARR_SINGLE(b)).offset
 
+// The bookmark cell's ->extra is not used by the index/offset mapping, so it
+// is used to memoize the case-folded hash of the whole string (see
+// Hash_Frozen_String()).  0 means no hash is cached.  Since it lives in the
+// bookmark, anything that calls Free_Bookmarks_Maybe_Null() drops it too.
+//
+#define BMK_HASH(b) \
+    EXTRA(Any, ARR_SINGLE(b)).u
+
+#define BMK_SKIPS(b) \
+    MISC(b).skips
+
+#define BMK_SKIP_STRIDE 256  // codepoints between skip index entries
+#define BMK_SKIP_MIN_LEN 4096  // shorter strings only use the last access
+
 inline static REBBMK* Alloc_Bookmark(void) {
     REBARR *bookmark = Alloc_Singular(SERIES_FLAG_MANAGED);
     CLEAR_SERIES_FLAG(bookmark, MANAGED);  // so it's manual but untracked
@@ -503,16 +526,118 @@ inline static REBBMK* Alloc_Bookmark(void) {
     // (its main type is still bookmark) but makes Is_Bindable() false
     //
     mutable_MIRROR_BYTE(ARR_SINGLE(bookmark)) = REB_LOGIC;
+    BMK_INDEX(bookmark) = 0;  // valid mapping for any string
+    BMK_OFFSET(bookmark) = 0;
+    BMK_HASH(bookmark) = 0;
+    BMK_SKIPS(bookmark) = nullptr;
     return bookmark;
 }
 
+inline static REBSER *Make_Bookmark_Skips(REBLEN capacity) {
+    REBSER *skips = Make_Series_Core(
+        capacity,
+        sizeof(REBSIZ),
+        SERIES_FLAG_MANAGED
+    );
+    CLEAR_SERIES_FLAG(skips, MANAGED);  // manual but untracked, as above
+    SET_SERIES_USED(skips, 0);
+    return skips;
+}
+
 inline static void Free_Bookmarks_Maybe_Null(REBSTR *s) {
     assert(not IS_STR_SYMBOL(s));  // call on string
-    if (LINK(s).bookmarks)
-        GC_Kill_Series(SER(LINK(s).bookmarks));  // recursive free whole list
+    REBBMK *bookmark = LINK(s).bookmarks;
+    if (bookmark) {
+        if (BMK_SKIPS(bookmark))
+            GC_Kill_Series(BMK_SKIPS(bookmark));
+        GC_Kill_Series(SER(bookmark));
+    }
     LINK(s).bookmarks = nullptr;
 }
 
+// Drop the skip index entries for codepoints after `index`, e.g. because
+// content was inserted or removed there.
+//
+inline static void Trim_Bookmark_Skips(REBBMK *bookmark, REBLEN index) {
+    REBSER *skips = BMK_SKIPS(bookmark);
+    if (skips and SER_USED(skips) > index / BMK_SKIP_STRIDE + 1)
+        SET_SERIES_USED(skips, index / BMK_SKIP_STRIDE + 1);
+}
+
+// Called when a string is modified at `index`, whose byte offset is the same
+// before and after the modification.  A last access past that point is
+// pulled back to it, and skip index entries past it are dropped.  Callers
+// that know how the last access moved (e.g. INSERT) can instead fix it up
+// themselves and just call Trim_Bookmark_Skips().
+//
+inline static void Update_Bookmarks_For_Modify(
+    REBSTR *s,
+    REBLEN index,
+    REBSIZ offset
+){
+    REBBMK *bookmark = LINK(s).bookmarks;
+    if (not bookmark)
+        return;
+
+    if (BMK_INDEX(bookmark) > index) {
+        BMK_INDEX(bookmark) = index;
+        BMK_OFFSET(bookmark) = offset;
+    }
+    Trim_Bookmark_Skips(bookmark, index);
+}
+
+// Get the byte offset of the nearest skip index entry at or before `at`,
+// filling in the index up to there if it doesn't reach that far yet.  The
+// codepoint index of the entry is returned, and is at most `at`.
+//
+inline static REBLEN Seek_Bookmark_Skips(
+    REBSIZ *offset_out,
+    REBSTR *s,
+    REBBMK *bookmark,
+    REBLEN at
+){
+    REBLEN needed = at / BMK_SKIP_STRIDE + 1;  // entries up to and at `at`
+
+    REBSER *skips = BMK_SKIPS(bookmark);
+    if (not skips or SER_REST(skips) < needed) {  // string grew, or first use
+        REBSER *bigger = Make_Bookmark_Skips(
+            STR_LEN(s) / BMK_SKIP_STRIDE + 1
+        );
+        if (not skips) {
+            *SER_HEAD(REBSIZ, bigger) = 0;  // codepoint 0 is at byte 0
+            SET_SERIES_USED(bigger, 1);
+        }
+        else {
+            memcpy(
+                SER_HEAD(REBSIZ, bigger),
+                SER_HEAD(REBSIZ, skips),
+                SER_USED(skips) * sizeof(REBSIZ)
+            );
+            SET_SERIES_USED(bigger, SER_USED(skips));
+            GC_Kill_Series(skips);
+        }
+        BMK_SKIPS(bookmark) = skips = bigger;
+    }
+
+    REBSIZ *table = SER_HEAD(REBSIZ, skips);
+    REBLEN used = SER_USED(skips);
+    if (used < needed) {
+        REBCHR(*) cp = cast(REBCHR(*),
+            SER_DATA_RAW(SER(s)) + table[used - 1]
+        );
+        for (; used != needed; ++used) {
+            REBLEN n;
+            for (n = 0; n != BMK_SKIP_STRIDE; ++n)
+                cp = NEXT_STR(cp);
+            table[used] = cp - STR_HEAD(s);
+        }
+        SET_SERIES_USED(skips, used);
+    }
+
+    *offset_out = table[needed - 1];
+    return (needed - 1) * BMK_SKIP_STRIDE;
+}
+
 #if !defined(NDEBUG)
     inline static void Check_Bookmarks_Debug(REBSTR *s) {
         REBBMK *bookmark = LINK(s).bookmarks;
@@ -531,6 +656,21 @@ inline static void Free_Bookmarks_Maybe_Null(REBSTR *s) {
 
         REBSIZ actual = cast(REBYTE*, cp) - SER_DATA_RAW(SER(s));
         assert(actual == offset);
+
+        REBSER *skips = BMK_SKIPS(bookmark);
+        if (not skips)
+            return;
+
+        cp = STR_HEAD(s);
+        REBLEN k;
+        for (k = 0; k != SER_USED(skips); ++k) {
+            assert(k * BMK_SKIP_STRIDE <= STR_LEN(s));
+            actual = cast(REBYTE*, cp) - SER_DATA_RAW(SER(s));
+            assert(actual == *SER_AT(REBSIZ, skips, k));
+            if (k + 1 != SER_USED(skips))
+                for (i = 0; i != BMK_SKIP_STRIDE; ++i)
+                    cp = NEXT_STR(cp);
+        }
     }
 #endif
 
@@ -592,7 +732,8 @@ inline static REBCHR(*) STR_AT(REBSTR *s, REBLEN at) {
         }
         if (not bookmark and not IS_STR_SYMBOL(s)) {
             LINK(s).bookmarks = bookmark = Alloc_Bookmark();
-            goto scan_from_head;  // will fill in bookmark
+            if (len < BMK_SKIP_MIN_LEN)
+                goto scan_from_head;  // will fill in bookmark
         }
     }
     else {
@@ -606,21 +747,35 @@ inline static REBCHR(*) STR_AT(REBSTR *s, REBLEN at) {
         }
         if (not bookmark and not IS_STR_SYMBOL(s)) {
             LINK(s).bookmarks = bookmark = Alloc_Bookmark();
-            goto scan_from_tail;  // will fill in bookmark
+            if (len < BMK_SKIP_MIN_LEN)
+                goto scan_from_tail;  // will fill in bookmark
         }
     }
 
-    // Theoretically, a large UTF-8 string could have multiple "bookmarks".
-    // That would complicate this logic by having to decide which one was
-    // closest to be using.  For simplicity we just use one right now to
-    // track the last access--which speeds up the most common case of an
-    // iteration.  Improve as time permits!
+    // The bookmark tracks the last access, which speeds up the most common
+    // case of an iteration.  If that's not near and the string is long, seek
+    // from the skip index instead of the head or tail--so the most that is
+    // walked is BMK_SKIP_STRIDE codepoints, wherever the access lands.
     //
-    assert(not bookmark or not LINK(bookmark).bookmarks);  // only one for now
+    assert(not bookmark or not LINK(bookmark).bookmarks);  // only one
 
   blockscope {
     REBLEN booked = BMK_INDEX(bookmark);
 
+    if (
+        len >= BMK_SKIP_MIN_LEN
+        and (at > booked ? at - booked : booked - at) >= BMK_SKIP_STRIDE
+        and len - at >= BMK_SKIP_STRIDE  // tail is close enough, use it
+    ){
+        REBSIZ offset;
+        index = Seek_Bookmark_Skips(&offset, s, bookmark, at);
+        cp = cast(REBCHR(*), SER_DATA_RAW(SER(s)) + offset);
+      #ifdef DEBUG_TRACE_BOOKMARKS
+        BOOKMARK_TRACE("skip index %ld, ", index);
+      #endif
+        goto scan_forward;  // at most BMK_SKIP_STRIDE - 1, updates bookmark
+    }
+
     // `at` is always positive.  `booked - at` may be negative, but if it
     // is positive and bigger than `at`, faster to seek from head.
     //
@@ -880,11 +1035,15 @@ inline static void SET_CHAR_AT(REBSTR *s, REBLEN n, REBUNI c) {
 
         // `cp` still is the start of the character for the index we were
         // dealing with.  Only update bookmark if it's an offset *after*
-        // that character position...
+        // that character position...and skip index entries past it are
+        // at the wrong offsets now.
         //
         REBBMK *book = LINK(s).bookmarks;
-        if (book and BMK_OFFSET(book) > cp_offset)
-            BMK_OFFSET(book) += delta;
+        if (book) {
+            if (BMK_OFFSET(book) > cp_offset)
+                BMK_OFFSET(book) += delta;
+            Trim_Bookmark_Skips(book, n);
+        }
     }
 
   #ifdef DEBUG_UTF8_EVERYWHERE  // see note on `len` at start of function
@@ -34,9 +34,14 @@
 
 // Linked list of used memory segments
 //
+// The counts are only kept for SER_POOL segments, by the recycler's sweep.
+// (They're pointer-sized so the nodes after a REBSEG stay 64-bit aligned.)
+//
 typedef struct rebol_mem_segment {
     struct rebol_mem_segment *next;
     uintptr_t size;
+    uintptr_t live;  // nodes in use after the segment was last swept
+    uintptr_t freed;  // nodes the last sweep of the segment freed
 } REBSEG;
 
 
@@ -68,6 +73,25 @@ struct rebol_mem_pool {
 
 #define MEM_BALLAST 3000000
 
+// Allocations too big for the pools, up to MEM_CACHE_MAX, are rounded up to
+// one of MEM_CACHE_STEPS size classes per doubling, and freed blocks are
+// kept in a cache for each class.  How many blocks a class holds adapts to
+// demand, but one class never holds more than MEM_CACHE_BYTES and all of
+// them together hold no more than MEM_CACHE_TOTAL.  (See Alloc_Mem())
+//
+#define MEM_CACHE_MIN (4 * MEM_BIG_SIZE)  // 4K and under come from pools
+#define MEM_CACHE_MAX (256 * 1024)
+#define MEM_CACHE_STEPS 4
+#define MEM_CACHE_CLASSES (6 * MEM_CACHE_STEPS)  // 4K << 6 is 256K
+#define MEM_CACHE_LIMIT 2  // blocks a class holds before demand is seen
+#define MEM_CACHE_BYTES (1024 * 1024)
+#define MEM_CACHE_TOTAL (8 * 1024 * 1024)
+
+// In generational mode, how many automatic minor recycles are done between
+// each full one.  (See Recycle_Auto())
+//
+#define GC_MINORS_PER_MAJOR 8
+
 enum Mem_Pool_Specs {
     MEM_TINY_POOL = 0,
     MEM_SMALL_POOLS = MEM_TINY_POOL + 16,
@@ -567,7 +567,7 @@
     (sizeof(double) > sizeof(void*) ? sizeof(double) : sizeof(void*))
 
 #define ALIGN(s,a) \
-    (((s) + (a) - 1) & ~((a) - 1)) // !!! this macro not used anywhere ATM
+    (((s) + (a) - 1) & ~((a) - 1))
 
 
 //=//// C FUNCTION TYPE (__cdecl) /////////////////////////////////////////=//
@@ -163,6 +163,44 @@ inline static bool Is_Overriding_Context(REBCTX *stored, REBCTX *override)
 }
 
 
+// Gives back `override` if a word bound to `stored` should be looked up in it
+// instead, else `stored`.  See Reb_Binding_Cache_Entry.
+//
+// Decisions involving FRAME!s aren't cached.  Their keysource changes as the
+// frame runs and ends, and they never override anyway.
+//
+inline static REBCTX *Get_Overriding_Context(REBCTX *stored, REBCTX *override)
+{
+    struct Reb_Binding_Cache_Entry *e = &TG_Binding_Cache[
+        ((cast(uintptr_t, stored) ^ (cast(uintptr_t, override) >> 3)) >> 4)
+            & (BINDING_CACHE_SIZE - 1)
+    ];
+    if (
+        e->stored == stored
+        and e->override == override
+        and e->epoch == TG_Binding_Epoch
+    ){
+        return e->result;
+    }
+
+    REBCTX *result = Is_Overriding_Context(stored, override)
+        ? override
+        : stored;
+
+    const uintptr_t frame_bits = NODE_FLAG_CELL | ARRAY_FLAG_IS_PARAMLIST;
+    if (
+        not (LINK_KEYSOURCE(stored)->header.bits & frame_bits)
+        and not (LINK_KEYSOURCE(override)->header.bits & frame_bits)
+    ){
+        e->stored = stored;
+        e->override = override;
+        e->result = result;
+        e->epoch = TG_Binding_Epoch;
+    }
+    return result;
+}
+
+
 // Modes allowed by Bind related functions:
 enum {
     BIND_0 = 0, // Only bind the words found in the context.
@@ -488,15 +526,15 @@ inline static REBCTX *Get_Var_Context(
         }
         else {
             REBNOD *f_binding = SPC_BINDING(specifier); // can't fail()
-            if (f_binding and Is_Overriding_Context(c, CTX(f_binding))) {
+            if (f_binding) {
                 //
-                // The specifier binding overrides--because what's happening 
-                // is that this cell came from a METHOD's body, where the
-                // particular ACTION! value cell triggering it held a binding
-                // of a more derived version of the object to which the
-                // instance in the method body refers.
+                // The specifier binding may override--because what's
+                // happening is that this cell came from a METHOD's body,
+                // where the particular ACTION! value cell triggering it held
+                // a binding of a more derived version of the object to which
+                // the instance in the method body refers.
                 //
-                c = CTX(f_binding);
+                c = Get_Overriding_Context(c, CTX(f_binding));
             }
         }
     }
@@ -704,13 +742,13 @@ inline static REBVAL *Derelativize(
     ){
         REBNOD *f_binding = SPC_BINDING(specifier); // can't fail(), see notes
 
-        if (
-            f_binding
-            and Is_Overriding_Context(CTX(binding), CTX(f_binding))
-        ){
+        if (f_binding) {
             // !!! Repeats code in Get_Var_Core, see explanation there
             //
-            INIT_BINDING_MAY_MANAGE(out, f_binding);
+            INIT_BINDING_MAY_MANAGE(
+                out,
+                NOD(Get_Overriding_Context(CTX(binding), CTX(f_binding)))
+            );
         }
         else
             INIT_BINDING_MAY_MANAGE(out, binding);
@@ -219,6 +219,60 @@ typedef struct rebol_stats {
     REBLEN  Objects;
 } REB_STATS;
 
+// Garbage collector timings are kept in release builds too, so that pause
+// times can be measured on the builds that are actually deployed.  Pauses
+// are in microseconds.
+//
+typedef struct rebol_gc_stats {
+    REBLEN  Minor_Recycles;
+    REBLEN  Major_Recycles;
+    REBI64  Minor_Pause_Total;
+    REBI64  Minor_Pause_Max;
+    REBI64  Major_Pause_Total;
+    REBI64  Major_Pause_Max;
+    REBI64  Promoted;  // series that became SERIES_INFO_OLD
+    REBLEN  Remembered;  // old series traced by the last minor recycle
+    REBLEN  Incremental_Recycles;  // completed RECYCLE/BUDGET cycles
+    REBLEN  Slices;  // steps taken by incremental recycles
+    REBI64  Slice_Pause_Total;
+    REBI64  Slice_Pause_Max;
+    REBLEN  Lazy_Sweeps;  // segments swept lazily (RECYCLE/LAZY)
+    REBI64  Trimmed_Bytes;  // pool segments given back, see Trim_Pools()
+} REB_GC_STATS;
+
+// Counts of the work done by Alloc_Mem() and Free_Mem(), also kept in
+// release builds, to see how often the size class caches spare a trip to
+// malloc() and free().
+//
+typedef struct rebol_mem_stats {
+    REBI64  Mallocs;  // calls to malloc() made by Alloc_Mem()
+    REBI64  Frees;  // calls to free() made by Free_Mem() and trimming
+    REBI64  Cache_Hits;  // blocks Alloc_Mem() took from a cache
+    REBI64  Cache_Returns;  // blocks Free_Mem() put in a cache
+    REBI64  Cached_Bytes;  // currently held by the caches
+    REBI64  Peak_Usage;  // highest PG_Mem_Usage seen
+} REB_MEM_STATS;
+
+// Use of the packrat cache by PARSE/MEMO, totaled over all such parses, to
+// see how often block rules are spared from being run again.
+//
+typedef struct rebol_parse_stats {
+    REBI64  Memo_Parses;  // PARSE/MEMO calls
+    REBI64  Memo_Lookups;  // block rules checked for a cached result
+    REBI64  Memo_Hits;  // ...which had one
+    REBI64  Memo_Stores;  // results cached
+    REBI64  Memo_Evictions;  // valid results replaced by other ones
+} REB_PARSE_STATS;
+
+// Large inputs the scanner split at top-level line feeds, see the notes on
+// Find_Scan_Splits() in %l-scan.c
+//
+typedef struct rebol_scan_stats {
+    REBI64  Split_Scans;  // inputs split into chunks
+    REBI64  Chunks;  // chunks scanned
+    REBI64  Fallbacks;  // inputs scanned again unsplit as a chunk failed
+} REB_SCAN_STATS;
+
 //-- Options of various kinds:
 typedef struct rebol_opts {
     bool  watch_recycle;
@@ -388,7 +442,14 @@ enum rebol_signals {
 
     // SIG_EVENT_PORT is to-be-documented
     //
-    SIG_EVENT_PORT = 1 << 3
+    SIG_EVENT_PORT = 1 << 3,
+
+    // SIG_LAZY_SWEEP is set by Make_Node() when it sweeps because the
+    // series pool ran dry.  It can't free series that run cleaners inside
+    // an allocation, so those are killed when the sweep is finished at the
+    // evaluator's next safe point.
+    //
+    SIG_LAZY_SWEEP = 1 << 4
 };
 
 inline static void SET_SIGNAL(REBFLGS f) { // used in %sys-series.h
@@ -40,6 +40,11 @@ PVAR REBINT PG_Boot_Level;  // User specified startup level
 
 PVAR REBU64 PG_Mem_Usage;   // Overall memory used
 PVAR REBU64 PG_Mem_Limit;   // Memory limit set by SECURE
+PVAR REB_MEM_STATS PG_Mem_Stats;  // malloc() calls and cache use
+PVAR REB_PARSE_STATS PG_Parse_Stats;  // PARSE/MEMO cache use
+PVAR REB_SCAN_STATS PG_Scan_Stats;  // large inputs scanned in chunks
+
+PVAR SCAN_CHUNKS_HOOK *PG_Scan_Chunks_Hook;  // see Scan_Chunks_Serially()
 
 // In Ren-C, words are REBSER nodes (REBSTR subtype).  They may be GC'd (unless
 // they are in the %words.r list, in which case their canon forms are
@@ -185,10 +190,18 @@ TVAR REBI64 TG_Max_Ballast;
 //-- Memory and GC:
 TVAR REBPOL *Mem_Pools;     // Memory pool array
 TVAR bool GC_Recycling;    // True when the GC is in a recycle
+TVAR bool GC_Minor;         // True when the recycle is only of young series
+TVAR bool GC_Marking;       // Incremental recycle is between marking slices
+TVAR bool GC_Sweeping;      // Some SER_POOL segments are yet to be swept
 TVAR REBINT GC_Ballast;     // Bytes allocated to force automatic GC
 TVAR bool GC_Disabled;      // true when RECYCLE/OFF is run
 TVAR REBSER *GC_Guarded; // A stack of GC protected series and values
 PVAR REBSER *GC_Mark_Stack; // Series pending to mark their reachables as live
+TVAR REBSER *GC_Remembered; // Old series written since last GC (see OLD)
+TVAR bool GC_Generational; // Automatic recycles are minor (mostly)
+TVAR REBI64 GC_Budget;      // Microseconds per incremental slice (0 is off)
+TVAR bool GC_Lazy;          // Automatic recycles sweep as allocations need
+TVAR REB_GC_STATS GC_Stats; // Counts and pause times, even in release builds
 TVAR REBSER **Prior_Expand; // Track prior series expansions (acceleration)
 
 TVAR REBSER *TG_Mold_Stack; // Used to prevent infinite loop in cyclical molds
@@ -198,6 +211,10 @@ TVAR REBSER *TG_Buf_Utf8; // UTF8 reused buffer
 TVAR REBSER *TG_Byte_Buf; // temporary byte buffer used mainly by raw print
 TVAR REBSTR *TG_Mold_Buf; // temporary UTF8 buffer - used mainly by mold
 
+TVAR REBSER *TG_Set_Check_Hashlist; // reused by set operations (see %n-sets.c)
+TVAR REBSER *TG_Set_Result_Hashlist;
+TVAR REBARR *TG_Buf_Set; // result buffer for set operations
+
 TVAR REBSER *GC_Manuals;    // Manually memory managed (not by GC)
 
 #if !defined(OS_STACK_GROWS_UP) && !defined(OS_STACK_GROWS_DOWN)
@@ -228,6 +245,17 @@ TVAR struct Reb_Feed TG_Frame_Feed_End;
 //
 TVAR REBARR *TG_Reuse;
 
+// Remembered decisions on derived binding overrides, see Reb_Context.
+//
+TVAR struct Reb_Binding_Cache_Entry TG_Binding_Cache[BINDING_CACHE_SIZE];
+TVAR REBLEN TG_Binding_Epoch;
+
+// Where the cells of action varlists are allocated, see Reb_Arena_Chunk.
+//
+TVAR struct Reb_Arena_Chunk *TG_Arena_Chunk;  // chunk being allocated from
+TVAR char *TG_Arena_Top;  // next free byte in TG_Arena_Chunk
+TVAR struct Reb_Arena_Block *TG_Arena_Last;  // most recent allocation
+
 //-- Evaluation stack:
 TVAR REBARR *DS_Array;
 TVAR REBDSP DS_Index;
@@ -86,8 +86,13 @@
 inline static void *Make_Node(REBLEN pool_id)
 {
     REBPOL *pool = &Mem_Pools[pool_id];
-    if (not pool->first) // pool has run out of nodes
-        Fill_Pool(pool); // refill it
+    if (not pool->first) { // pool has run out of nodes
+        if (pool_id == SER_POOL and GC_Sweeping)
+            Sweep_For_Node(); // sweep segments, leaving cleaners for later
+
+        if (not pool->first)
+            Fill_Pool(pool); // refill it
+    }
 
     assert(pool->first);
 
@@ -142,6 +147,16 @@ inline static void Free_Node(REBLEN pool_id, REBNOD *node)
 
     mutable_FIRST_BYTE(node->header) = FREED_SERIES_BYTE;
 
+    // While a sweep is pending, a node handed out by Make_Node() must not be
+    // in a segment the sweep hasn't reached, else it would be freed for lack
+    // of a mark.  So frees are set aside until it's known to be safe.  (See
+    // "LAZY AND INCREMENTAL SWEEPING" in %m-gc.c)
+    //
+    if (pool_id == SER_POOL and GC_Sweeping) {
+        Park_Freed_Node(node);
+        return;
+    }
+
     REBPOL *pool = &Mem_Pools[pool_id];
 
   #ifdef NDEBUG
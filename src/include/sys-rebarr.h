@@ -149,6 +149,26 @@ STATIC_ASSERT(ARRAY_FLAG_CONST_SHALLOW == CELL_FLAG_CONST);
 #define ARRAY_FLAG_31 FLAG_LEFT_BIT(31)
 
 
+//=//// ARRAY_FLAG_PARSE_COMPILED /////////////////////////////////////////=//
+//
+// A plain source array (not a paramlist, varlist, or pairlist) that PARSE
+// has compiled rule programs or PARSE/MEMO results for.  These must be
+// forgotten if the array is modified or freed.  See notes in %u-parse.c
+//
+#define ARRAY_FLAG_PARSE_COMPILED \
+    ARRAY_FLAG_25
+
+
+//=//// ARRAY_FLAG_FIND_INDEXED ///////////////////////////////////////////=//
+//
+// A plain array (not a paramlist, varlist, or pairlist) that FIND has been
+// counting searches of, or has built a hash index for.  This must be
+// forgotten if the array is modified or freed.  See notes in %t-block.c
+//
+#define ARRAY_FLAG_FIND_INDEXED \
+    ARRAY_FLAG_26
+
+
 //=//////////// ^-- STOP ARRAY FLAGS AT FLAG_LEFT_BIT(31) --^ /////////////=//
 
 // Arrays can use all the way up to the 32-bit limit on the flags (since
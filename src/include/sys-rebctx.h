@@ -47,6 +47,28 @@ struct Reb_Context {
 };
 
 
+// Words bound to an object, when run from the body of a function invoked
+// through a binding to a derived object, look up in the derived object
+// instead.  Deciding if the derivation applies walks the keylist ancestry
+// (see Is_Overriding_Context()), which is cached in a small table keyed by
+// the two contexts.  Entries are only good for the TG_Binding_Epoch they
+// were made in, which advances when a varlist is freed (its address could
+// be reused) or an object's keylist is replaced by Expand_Context().
+//
+// Only lookups in a frame whose action has an object binding (a METHOD run
+// through an object, whether or not it is derived) use the cache.  Words in
+// plain functions and mezzanines are found from the cell without it.
+//
+struct Reb_Binding_Cache_Entry {
+    REBCTX *stored;  // context the word is bound to
+    REBCTX *override;  // binding of the frame the word is looked up in
+    REBCTX *result;  // either `stored` or `override`
+    REBLEN epoch;
+};
+
+#define BINDING_CACHE_SIZE 64  // must be a power of 2
+
+
 #if !defined(DEBUG_CHECK_CASTS)
 
     #define CTX(p) \
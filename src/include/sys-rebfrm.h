@@ -766,6 +766,41 @@ struct Reb_Frame {
 typedef bool (REBEVL)(REBFRM * const);
 
 
+//=//// FRAME ARENA ///////////////////////////////////////////////////////=//
+//
+// The cells of a running action's varlist don't come from the memory pools,
+// but from an arena that is allocated from and freed in LIFO order...as
+// frames are pushed and dropped in stack order.  So giving an action its
+// arguments is usually just bumping a pointer.  If the varlist is managed
+// (e.g. a FRAME! for it was made) the cells are copied out to an ordinary
+// series allocation when the action ends, see Reify_Varlist_In_Arena().
+//
+// The arena is a list of chunks.  Each allocation is preceded by a header
+// linking to the allocation before it.  If one is freed out of order it is
+// only marked, and its space is reclaimed when everything above it is.
+//
+struct Reb_Arena_Chunk {
+    struct Reb_Arena_Chunk *prev;
+    struct Reb_Arena_Chunk *next;  // emptied chunks are kept for reuse
+    char *limit;  // end of this chunk's memory
+    size_t size;  // total size including this header, for FREE_N()
+};
+
+struct Reb_Arena_Block {
+    struct Reb_Arena_Block *prev;  // allocation before this one, or nullptr
+    struct Reb_Arena_Chunk *chunk;  // chunk this allocation lives in
+    uintptr_t freed;  // nonzero if freed before the allocations above it
+};
+
+#define ARENA_CHUNK_HEADER \
+    ALIGN(sizeof(struct Reb_Arena_Chunk), ALIGN_SIZE)
+
+#define ARENA_BLOCK_HEADER \
+    ALIGN(sizeof(struct Reb_Arena_Block), ALIGN_SIZE)
+
+#define FRAME_ARENA_CHUNK_SIZE (64 * 1024)  // unless a frame needs more
+
+
 #if !defined(DEBUG_CHECK_CASTS)
 
     #define FRM(p) \
@@ -468,15 +468,27 @@ STATIC_ASSERT(SERIES_INFO_7_IS_FALSE == NODE_FLAG_CELL);
     FLAG_LEFT_BIT(28)
 
 
-//=//// SERIES_INFO_29 ////////////////////////////////////////////////////=//
+//=//// SERIES_INFO_OLD ///////////////////////////////////////////////////=//
 //
-#define SERIES_INFO_29 \
+// Set by the garbage collector on a managed series that has survived a
+// recycle.  A minor recycle (see Recycle_Minor()) does not trace into old
+// series or free them, so it only pays for series made since the last GC.
+//
+// Series are "young" when they are first managed, since the info bits are
+// reset whenever a node is allocated.
+//
+#define SERIES_INFO_OLD \
     FLAG_LEFT_BIT(29)
 
 
-//=//// SERIES_INFO_30 ////////////////////////////////////////////////////=//
+//=//// SERIES_INFO_REMEMBERED ////////////////////////////////////////////=//
+//
+// An old series that has been written to since the last recycle, and may
+// now hold references to young series that the minor GC would not find by
+// tracing from the roots.  It is in the GC_Remembered list, so the minor GC
+// will trace its contents.  See Remember_Series_Write() for the barrier.
 //
-#define SERIES_INFO_30 \
+#define SERIES_INFO_REMEMBERED \
     FLAG_LEFT_BIT(30)
 
 
@@ -703,6 +715,13 @@ union Reb_Series_Misc {
     //
     REBLEN length;
 
+    // The first bookmark of a long string may hold a "skip index": a series
+    // of byte offsets for every BMK_SKIP_STRIDE'th codepoint, which lets
+    // STR_AT() do random access without seeking from the head or tail.  It
+    // is built lazily and trimmed on modification (see %sys-string.h)
+    //
+    REBSER *skips;
+
     // When binding words into a context, it's necessary to keep a table
     // mapping those words to indices in the context's keylist.  R3-Alpha
     // had a global "binding table" for the spellings of words, where
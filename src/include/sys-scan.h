@@ -304,6 +304,11 @@ typedef struct rebol_scan_state {  // shared across all levels of a scan
     REBLIN line;  // line number where current scan position is
     const REBYTE *line_head;  // pointer to head of current line (for errors)
 
+    // Codepoint count of a TEXT! token that had no escapes, so its content
+    // was not put in the mold buffer (see Scan_Quote_Push_Mold())
+    //
+    REBLEN quote_len;
+
     // The "limit" feature was not implemented, scanning just stopped at '\0'.
     // It may be interesting in the future, but it doesn't mix well with
     // scanning variadics which merge REBVAL and UTF-8 strings together...
@@ -356,6 +361,29 @@ enum {
     SCAN_FLAG_LOCK_SCANNED = 1 << 3  // lock series as they are loaded
 };
 
+// A large UTF-8 input is split at top-level line feeds into chunks which are
+// scanned independently, see Find_Scan_Splits() in %l-scan.c
+//
+struct Reb_Scan_Chunk {
+    const REBYTE *begin;  // points into the input (not terminated)
+    REBSIZ size;
+    REBLIN line;  // line number at `begin`
+
+    REBARR *array;  // unmanaged array of the values, nullptr if scan failed
+    REBLIN end_line;  // line number at the end of the scan
+    bool newline_pending;  // line feed seen after the last value
+};
+
+// Scans each chunk with Scan_Chunk().  The default, Scan_Chunks_Serially(),
+// scans them one after another on the calling thread.
+//
+typedef void (SCAN_CHUNKS_HOOK)(
+    struct Reb_Scan_Chunk *chunks,
+    REBLEN num_chunks,
+    REBSTR *file,
+    REBFLGS opts
+);
+
 
 //
 // MAXIMUM LENGTHS
@@ -0,0 +1,57 @@
+//
+//  File: %sys-simd.h
+//  Summary: "Vector instruction availability and bit scanning helpers"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2019 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// A few hot loops (scanning, FIND on strings and binaries, hash probing in
+// maps) look at 16 bytes at a time when SSE2 is available.  They are only
+// included by the files that have those loops, so the intrinsics headers
+// are not pulled into everything that includes %sys-core.h.
+//
+// The loops turn a vector compare into a bit mask with a bit per byte, and
+// the first match is at the position of the lowest set bit.
+//
+
+#ifndef __SYS_SIMD_H_
+#define __SYS_SIMD_H_
+
+#if defined(__SSE2__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define REB_SSE2
+#endif
+
+
+// Number of the lowest set bit in a mask (which must not be zero).
+//
+inline static REBLEN Lowest_Set_Bit(uint64_t mask) {
+    assert(mask != 0);
+  #if defined(__GNUC__) || defined(__clang__)
+    return cast(REBLEN, __builtin_ctzll(mask));
+  #else
+    REBLEN n = 0;
+    while (not (mask & 1)) {
+        mask >>= 1;
+        ++n;
+    }
+    return n;
+  #endif
+}
+
+#endif
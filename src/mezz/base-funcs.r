@@ -1136,3 +1136,105 @@ input-lines: redescribe [
 ](
     specialize :read-lines [src: _]
 )
+
+read-values: func [
+    {Makes a generator that yields values TRANSCODEd from a file or port.}
+    src "Port or file to READ/PART from, or action giving BINARY! chunks"
+        [port! file! action!]
+    /part "Bytes to read at a time (default 65536)"
+        [integer!]
+    /file "File to be associated with BLOCK!s and GROUP!s in source"
+        [file! url!]
+][
+    ; Only the bytes of values not yet yielded are kept, so large files of
+    ; many top-level values can be loaded in constant memory.  The scanner
+    ; can't suspend in the middle of a value, so a value which is cut off
+    ; by the end of the buffer (it fails to scan, or its scan reaches the
+    ; end, where more bytes could extend it) is scanned again after reading
+    ; more.  Each retry waits for the buffer to double so that a huge value
+    ; (like a block spanning the whole file) only costs linear time.
+    ;
+    ; A port opened here from a FILE! is closed on reaching its end.
+    ;
+    let close-src: if file? src [
+        src: open src
+        compose [close (src)]
+    ]
+    part: default [65536]
+
+    ; A scan error only means more bytes are needed if the scanner ran out
+    ; of input: a closing delimiter is missing, or the bad token (or broken
+    ; UTF-8 sequence) is at the very end, e.g. `1.5e` cut from `1.5e10`.
+    ; Other errors can't be fixed by reading more, so they fail right away.
+    ;
+    let cut-off?: func [error [error!] buf [binary!]] [
+        return did case [
+            error/id = 'scan-missing [true]
+            error/id = 'scan-invalid [
+                let text: as binary! error/arg2
+                text = skip tail of buf negate length of text
+            ]
+            error/id = 'bad-utf8 [
+                all [not tail? buf, 128 <= last buf]
+            ]
+        ]
+    ]
+
+    let read-chunk: either action? :src [
+        compose [(:src)]
+    ][
+        compose [read/part (src) (part)]
+    ]
+    let scan: either file [
+        compose [transcode/file/line pos (file) 'l]
+    ][
+        [transcode/line pos 'l]
+    ]
+
+    function compose [
+        <static> pos (to group! compose [make binary! (part)])
+        <static> line (1)
+        <static> want (0)  ; bytes to buffer before scanning again
+        <static> eof (false)
+    ] compose/deep [
+        cycle [
+            if any [eof, want <= length of pos] [
+                let l: line
+                let value
+                let rest
+                let error: trap [
+                    [value rest]: ((scan))
+                ]
+                case [
+                    error [
+                        if eof [fail error]  ; port was closed at its end
+                        if not (:cut-off?) error pos [
+                            ((close-src))
+                            fail error
+                        ]
+                    ]
+                    null? :value [
+                        if eof [return null]  ; only whitespace or comments
+                    ]
+                    any [eof, not tail? rest] [
+                        pos: rest
+                        line: l
+                        want: 0
+                        return :value
+                    ]
+                ]
+                want: 1 + (2 * length of pos)
+            ]
+            if not head? pos [
+                pos: remove/part head of pos pos  ; drop what was yielded
+            ]
+            let data: ((read-chunk))
+            if any [null? data, empty? data] [
+                eof: true
+                ((close-src))
+            ] else [
+                append pos data
+            ]
+        ]
+    ]
+]
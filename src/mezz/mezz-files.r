@@ -400,6 +400,48 @@ detab-file: function [
     write filename detab to text! read filename
 ]
 
+zstream-copy: function [
+    {Pass data from one port to another through a ZSTREAM, a chunk at a time}
+
+    return: "Number of bytes written to the target"
+        [integer!]
+    stream "From ZSTREAM or ZSTREAM/INFLATE (finished when this is done)"
+        [handle!]
+    source "Read with READ/PART until there is no more data"
+        [port!]
+    target [port!]
+    /chunk "How many bytes to read at once (default 64K)"
+        [integer!]
+][
+    ; Memory use stays bounded for any size of input, so this can be used to
+    ; e.g. gunzip a log file many times bigger than memory:
+    ;
+    ;     zstream-copy zstream/inflate/envelope 'gzip
+    ;         open %big.log.gz
+    ;         open/new %big.log
+    ;
+    chunk: default [65536]
+    out: make binary! chunk
+    total: 0
+    while [
+        data: read/part source chunk
+        all [binary? data | not empty? data]
+    ][
+        zstream-update/into stream data clear out
+        if not empty? out [
+            write target out
+            total: total + length of out
+        ]
+    ]
+    zstream-update/finish/into stream _ clear out
+    if not empty? out [
+        write target out
+        total: total + length of out
+    ]
+    return total
+]
+
+
 ; temporary location
 set-net: function [
     {sets the system/user/identity email smtp pop3 esmtp-usr esmtp-pass fqdn}
@@ -137,6 +137,7 @@
 %convert/encode.test.reb
 %convert/load.test.reb
 %convert/mold.test.reb
+%convert/rebin.test.reb
 %convert/to.test.reb
 
 %define/func.test.reb
@@ -163,6 +164,7 @@
 %functions/modal.test.reb
 %functions/multi.test.reb
 %functions/oneshot.test.reb
+%functions/read-values.test.reb
 %functions/redescribe.test.reb
 %functions/redo.test.reb
 %functions/specialize.test.reb
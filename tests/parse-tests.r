@@ -577,3 +577,138 @@
     (did parse "ab" [thru ["a"] "b" end])
     (not parse "ab" [thru ["ab"] "" end])
 ]
+
+; Rules made of chars, strings, bitsets, SKIP, END, and blocks are compiled
+; for TEXT! and BINARY! input, but must act the same as the interpreter.
+; Changing the rule block or a variable it uses must also be noticed.
+[
+    (did parse "aaab" [some #"a" #"b" end])
+    (not parse "aaab" [some #"a" end])
+    (did parse "AaA" [3 #"a" end])
+    (not parse/case "AaA" [3 #"a" end])
+    (did parse "abcabc" [2 4 ["abc" | "x"] end])
+    (not parse "abcabc" [3 4 "abc" end])
+    (did parse "aab" [while [#"a" | end] #"b" end])
+    (did parse "" [any [#"a" | end] end])
+    (did parse "ab中" [skip skip #"中" end])
+    (did parse #{E4B8AD} [#"中" end])
+    (did parse #{0102FF} [some [#{01} | #{02}] #{FF} end])
+    (
+        digit: charset "0123456789"
+        did parse "2019-11-24" [4 digit #"-" 2 digit #"-" 2 digit end]
+    )
+    (
+        rules: copy [some "a" end]
+        r1: did parse "aaa" rules
+        change next rules "b"
+        r2: did parse "bbb" rules
+        r3: not parse "aaa" rules
+        all [r1 r2 r3]
+    )
+    (
+        rule: [some w end]
+        w: "a"
+        r1: did parse "aa" rule
+        w: integer!
+        r2: did parse "12" rule
+        w: "a"
+        r3: did parse "aa" rule
+        all [r1 r2 r3]
+    )
+    (
+        ; Repeating one rule many times counts down to signal processing,
+        ; which may run the GC.  Freeing other compiled rule blocks then
+        ; must not free the running program (the parse bails instead).
+        ;
+        loop 1000 [parse "a" copy [#"a" end]]
+        s: append/dup copy "" "a" 1000000
+        all [
+            did parse s [some #"a" end]
+            did parse s [some [#"a" | #"b"] end]
+        ]
+    )
+]
+
+; PARSE/MEMO caches the results of block rules by input position, so this
+; grammar (which retries TERM after failing to find "+") isn't exponential.
+[
+    (
+        expr: [term "+" expr | term]
+        term: ["(" expr ")" | "n"]
+        nested: copy "n"
+        loop 24 [nested: unspaced ["(" nested ")"]]
+        true
+    )
+    (
+        before: stats/parse
+        r: did parse/memo nested [expr end]
+        after: stats/parse
+        all [
+            r
+            after/memo-parses = (before/memo-parses + 1)
+            after/hits > before/hits
+        ]
+    )
+    (did parse/memo "(n+n)+n" [expr end])
+    (not parse/memo "(n+n" [expr end])
+    (did parse/budget "((n+n)+(n))+n" [expr end] 1000)
+    (
+        s: copy "aab"
+        all [
+            did parse/memo s [some [remove "a"] "b" end]
+            s = "b"
+        ]
+    )
+    (
+        ; A GROUP! that changes the input must not leave results from
+        ; before the change to be hit when X is tried again at that spot.
+        ;
+        s: copy "ab"
+        x: ["a"]
+        all [
+            not parse/memo s [[x (change s "z") fail] | [x "b" end]]
+            s = "zb"
+        ]
+    )
+]
+
+; Repeating a bitset over TEXT! or BINARY! scans the run at once.  Bytes
+; from non-ASCII characters (or caseless non-ASCII BINARY! bytes) are checked
+; one codepoint at a time, and counts must be honored across both.
+[
+    (
+        letter: charset [#"a" - #"z" #"é"]
+        not-letter: complement letter
+        digit: charset "0123456789"
+        low-bytes: charset [1 2 3 4 5]
+        e-acute: charset [233]
+        true
+    )
+    (did parse "abcé123" [some letter some digit end])
+    (did parse "ABCÉ" [some letter end])
+    (not parse/case "ABCÉ" [some letter end])
+    (did parse "aéaé" [2 4 letter end])
+    (not parse "aéaéa" [2 4 letter end])
+    (not parse "a1" [2 4 letter digit end])
+    (did parse "" [any letter end])
+    (not parse "" [some letter end])
+    (did parse "1" [while letter digit end])
+    (
+        s: copy ""
+        loop 50 [append s "abcdefghéjklmnop"]
+        append s "0"
+        loop 50 [append s "abcdefghijklmnop"]
+        did parse s [some letter digit some letter end]
+    )
+    (
+        did all [
+            parse "abc中123" [copy x some letter "中" copy y some digit end]
+            x = "abc"
+            y = "123"
+        ]
+    )
+    (did parse "中中x" [some not-letter #"x" end])
+    (did parse #{0102030405FF} [some low-bytes #{FF} end])
+    (did parse #{C9E9} [2 e-acute end])
+    (not parse/case #{C9E9} [2 e-acute end])
+]
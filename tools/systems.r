@@ -82,7 +82,7 @@ systems: [
         #SGD #LEN #LLC #NSER #F64 <NCM> <NPS> <ARC> /HID /ARC /DYN %M
 
     0.2.40 osx-x64/osx _
-        #SGD #LEN #LLC #NSER #F64 <NCM> <NPS> /HID /DYN %M
+        #SGD #LEN #LLC #NSER #F64 #PTH <NCM> <NPS> /HID /DYN %M %PTH
 
     Windows: 3
     ;-------------------------------------------------------------------------
@@ -108,7 +108,7 @@ systems: [
         #SGD #LEN #LLC #F64 <M32> <UFS> /M32 %M %DL
 
     0.4.04 linux-x86/linux "libc6-2-11-x86"  ; glibc-2.11
-        #SGD #LEN #LLC #F64 #PIP2 <M32> <HID> /M32 /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PTH #PIP2 <M32> <HID> /M32 /HID /DYN %M %DL %PTH
 
     0.4.05 _ _
         ; was: "Linux 68K"
@@ -126,34 +126,34 @@ systems: [
         ; was: "Linux Cobalt Qube MIPS"
 
     0.4.10 linux-ppc/linux "libc6-ppc"
-        #SGD #BEN #LLC #F64 #PIP2 <HID> /HID /DYN %M %DL
+        #SGD #BEN #LLC #F64 #PTH #PIP2 <HID> /HID /DYN %M %DL %PTH
 
     0.4.11 linux-ppc64/linux "libc6-ppc64"
-        #SGD #BEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL
+        #SGD #BEN #LLC #F64 #PTH #PIP2 #LP64 <HID> /HID /DYN %M %DL %PTH
 
     0.4.20 linux-arm/linux "libc6-arm"
-        #SGD #LEN #LLC #F64 #PIP2 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PTH #PIP2 <HID> /HID /DYN %M %DL %PTH
 
     0.4.21 linux-arm/linux _  ; for modern Android builds, see Android section
-        #SGD #LEN #LLC #F64 #PIP2 <HID> <PIE> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PTH #PIP2 <HID> <PIE> /HID /DYN %M %DL %PTH
 
     0.4.22 linux-aarch64/linux "libc6-aarch64"
-        #SGD #LEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PTH #PIP2 #LP64 <HID> /HID /DYN %M %DL %PTH
 
     0.4.30 linux-mips/linux "libc6-mips"
-        #SGD #LEN #LLC #F64 #PIP2 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PTH #PIP2 <HID> /HID /DYN %M %DL %PTH
 
     0.4.31 linux-mips32be/linux "libc6-mips32be"
-        #SGD #BEN #LLC #F64 #PIP2 <HID> /HID /DYN %M %DL
+        #SGD #BEN #LLC #F64 #PTH #PIP2 <HID> /HID /DYN %M %DL %PTH
 
     0.4.40 linux-x64/linux "libc-x64"
-        #SGD #LEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PTH #PIP2 #LP64 <HID> /HID /DYN %M %DL %PTH
 
     0.4.60 linux-axp/linux "dec-alpha"
-        #SGD #LEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PTH #PIP2 #LP64 <HID> /HID /DYN %M %DL %PTH
 
     0.4.61 linux-ia64/linux "libc-ia64"
-        #SGD #LEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PTH #PIP2 #LP64 <HID> /HID /DYN %M %DL %PTH
 
     BeOS: 5
     ;-------------------------------------------------------------------------
@@ -180,7 +180,7 @@ systems: [
         #SGD #LEN #LLC #F64 %M
 
     0.7.40 freebsd-x64/posix _
-        #SGD #LEN #LLC #F64 #LP64 %M
+        #SGD #LEN #LLC #F64 #PTH #LP64 %M %PTH
 
     NetBSD: 8
     ;-------------------------------------------------------------------------
@@ -217,7 +217,7 @@ systems: [
         ; was: "OpenBSD Sparc"
 
     0.9.40 openbsd-x64/posix "elf-x64"
-        #SGD #LEN #LLC #F64 #LP64 %M
+        #SGD #LEN #LLC #F64 #PTH #LP64 %M %PTH
 
     Sun: 10
     ;-------------------------------------------------------------------------
@@ -366,6 +366,7 @@ system-definitions: make object! [
     ; intended to be used with the standard compiler for that platform.
     ;
     PIP2: "USE_PIPE2_NOT_PIPE"    ; pipe2() linux only, glibc 2.9 or later
+    PTH: "USE_PTHREADS"           ; e.g. SORT runs radix passes on threads
     NSER:                         ; strerror_r() in glibc 2.3.4, not 2.3.0
         "USE_STRERROR_NOT_STRERROR_R"
 ]
@@ -420,6 +421,7 @@ system-libraries: make object! [
     M: <gnu:m>
 
     DL: "dl" ; dynamic lib
+    PTH: "pthread" ; POSIX threads
     LOG: "log" ; Link with liblog.so on Android
     
     W32: ["wsock32" "comdlg32" "user32" "shell32" "advapi32"]